@@ -16,6 +16,49 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationInstance)
 
+namespace AlsAnimationInstanceCurves
+{
+	// Indices of the curves in the curves cache.
+
+	enum : uint8
+	{
+		LayerHead,
+		LayerHeadAdditive,
+		LayerHeadSlot,
+		LayerArmLeft,
+		LayerArmLeftAdditive,
+		LayerArmLeftSlot,
+		LayerArmLeftLocalSpace,
+		LayerArmRight,
+		LayerArmRightAdditive,
+		LayerArmRightSlot,
+		LayerArmRightLocalSpace,
+		LayerHandLeft,
+		LayerHandRight,
+		LayerSpine,
+		LayerSpineAdditive,
+		LayerSpineSlot,
+		LayerPelvis,
+		LayerPelvisSlot,
+		LayerLegs,
+		LayerLegsSlot,
+		PoseGrounded,
+		PoseInAir,
+		PoseStanding,
+		PoseCrouching,
+		PoseMoving,
+		PoseGait,
+
+		Count
+	};
+}
+
+namespace AlsAnimationInstance
+{
+	// Due to network smoothing, teleportation is assumed to take this long instead of a single frame.
+	constexpr auto TeleportDuration{0.2f};
+}
+
 void UAlsAnimationInstance::NativeInitializeAnimation()
 {
 	Super::NativeInitializeAnimation();
@@ -29,6 +72,8 @@ void UAlsAnimationInstance::NativeInitializeAnimation()
 		Character = GetMutableDefault<AAlsCharacter>();
 	}
 #endif
+
+	RefreshCurvesCacheOnGameThread();
 }
 
 void UAlsAnimationInstance::NativeBeginPlay()
@@ -80,6 +125,7 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 	Stance = Character->GetStance();
 	Gait = Character->GetGait();
 	OverlayMode = Character->GetOverlayMode();
+	LodLevel = Character->GetLodLevel();
 
 	if (LocomotionAction != Character->GetLocomotionAction())
 	{
@@ -87,6 +133,7 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 		ResetGroundedEntryMode();
 	}
 
+	RefreshCurvesCacheOnGameThread();
 	RefreshMovementBaseOnGameThread();
 	RefreshViewOnGameThread();
 	RefreshLocomotionOnGameThread();
@@ -137,16 +184,24 @@ void UAlsAnimationInstance::NativePostUpdateAnimation()
 	PlayQueuedTurnInPlaceAnimation();
 	StopQueuedTransitionAndTurnInPlaceAnimations();
 
+	if (Settings->Feet.bUseAsyncIkTraces)
+	{
+		// Both feet traces are submitted together after the animation update so
+		// that their results can be received at the beginning of the next frame.
+
+		RequestFootOffsetTraceOnGameThread(FeetState.LeftOffsetTrace);
+		RequestFootOffsetTraceOnGameThread(FeetState.RightOffsetTrace);
+	}
+
 #if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
 	if (!bPendingUpdate)
 	{
-		for (const auto& DisplayDebugTraceFunction : DisplayDebugTracesQueue)
-		{
-			DisplayDebugTraceFunction();
-		}
+		DisplayDebugTracesBuffer.Flush(GetWorld());
+	}
+	else
+	{
+		DisplayDebugTracesBuffer.Reset();
 	}
-
-	DisplayDebugTracesQueue.Reset();
 #endif
 
 	bPendingUpdate = false;
@@ -175,6 +230,70 @@ FAlsControlRigInput UAlsAnimationInstance::GetControlRigInput() const
 	};
 }
 
+void UAlsAnimationInstance::RefreshCurvesCacheOnGameThread()
+{
+	const USkeleton* Skeleton{CurrentSkeleton};
+	if (CurvesCache.IsInitializedFor(Skeleton))
+	{
+		return;
+	}
+
+	// Each curve name is paired with its index from the AlsAnimationInstanceCurves
+	// namespace, so the names can't get out of order with the indices.
+
+	struct FCurve
+	{
+		uint8 Index;
+		FName Name;
+	};
+
+	const FCurve Curves[]
+	{
+		{AlsAnimationInstanceCurves::LayerHead, UAlsConstants::LayerHeadCurveName()},
+		{AlsAnimationInstanceCurves::LayerHeadAdditive, UAlsConstants::LayerHeadAdditiveCurveName()},
+		{AlsAnimationInstanceCurves::LayerHeadSlot, UAlsConstants::LayerHeadSlotCurveName()},
+		{AlsAnimationInstanceCurves::LayerArmLeft, UAlsConstants::LayerArmLeftCurveName()},
+		{AlsAnimationInstanceCurves::LayerArmLeftAdditive, UAlsConstants::LayerArmLeftAdditiveCurveName()},
+		{AlsAnimationInstanceCurves::LayerArmLeftSlot, UAlsConstants::LayerArmLeftSlotCurveName()},
+		{AlsAnimationInstanceCurves::LayerArmLeftLocalSpace, UAlsConstants::LayerArmLeftLocalSpaceCurveName()},
+		{AlsAnimationInstanceCurves::LayerArmRight, UAlsConstants::LayerArmRightCurveName()},
+		{AlsAnimationInstanceCurves::LayerArmRightAdditive, UAlsConstants::LayerArmRightAdditiveCurveName()},
+		{AlsAnimationInstanceCurves::LayerArmRightSlot, UAlsConstants::LayerArmRightSlotCurveName()},
+		{AlsAnimationInstanceCurves::LayerArmRightLocalSpace, UAlsConstants::LayerArmRightLocalSpaceCurveName()},
+		{AlsAnimationInstanceCurves::LayerHandLeft, UAlsConstants::LayerHandLeftCurveName()},
+		{AlsAnimationInstanceCurves::LayerHandRight, UAlsConstants::LayerHandRightCurveName()},
+		{AlsAnimationInstanceCurves::LayerSpine, UAlsConstants::LayerSpineCurveName()},
+		{AlsAnimationInstanceCurves::LayerSpineAdditive, UAlsConstants::LayerSpineAdditiveCurveName()},
+		{AlsAnimationInstanceCurves::LayerSpineSlot, UAlsConstants::LayerSpineSlotCurveName()},
+		{AlsAnimationInstanceCurves::LayerPelvis, UAlsConstants::LayerPelvisCurveName()},
+		{AlsAnimationInstanceCurves::LayerPelvisSlot, UAlsConstants::LayerPelvisSlotCurveName()},
+		{AlsAnimationInstanceCurves::LayerLegs, UAlsConstants::LayerLegsCurveName()},
+		{AlsAnimationInstanceCurves::LayerLegsSlot, UAlsConstants::LayerLegsSlotCurveName()},
+		{AlsAnimationInstanceCurves::PoseGrounded, UAlsConstants::PoseGroundedCurveName()},
+		{AlsAnimationInstanceCurves::PoseInAir, UAlsConstants::PoseInAirCurveName()},
+		{AlsAnimationInstanceCurves::PoseStanding, UAlsConstants::PoseStandingCurveName()},
+		{AlsAnimationInstanceCurves::PoseCrouching, UAlsConstants::PoseCrouchingCurveName()},
+		{AlsAnimationInstanceCurves::PoseMoving, UAlsConstants::PoseMovingCurveName()},
+		{AlsAnimationInstanceCurves::PoseGait, UAlsConstants::PoseGaitCurveName()}
+	};
+
+	static_assert(UE_ARRAY_COUNT(Curves) == AlsAnimationInstanceCurves::Count);
+
+	FName CurveNames[AlsAnimationInstanceCurves::Count];
+
+	for (const auto& Curve : Curves)
+	{
+		CurveNames[Curve.Index] = Curve.Name;
+	}
+
+	for (const auto& CurveName : CurveNames)
+	{
+		ALS_ENSURE_MESSAGE(!CurveName.IsNone(), TEXT("Each curve index must be paired with exactly one curve name."));
+	}
+
+	CurvesCache.Initialize(CurveNames, Skeleton);
+}
+
 void UAlsAnimationInstance::RefreshMovementBaseOnGameThread()
 {
 	const auto& BasedMovement{Character->GetBasedMovement()};
@@ -207,71 +326,53 @@ void UAlsAnimationInstance::RefreshLayering()
 {
 	const auto& Curves{GetProxyOnAnyThread<FAlsAnimationInstanceProxy>().GetAnimationCurves(EAnimCurveType::AttributeCurve)};
 
-	static const auto GetCurveValue{
-		[](const TMap<FName, float>& Curves, const FName& CurveName) -> float
-		{
-			const auto* Value{Curves.Find(CurveName)};
-
-			return Value != nullptr ? *Value : 0.0f;
-		}
-	};
-
-	LayeringState.HeadBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerHeadCurveName());
-	LayeringState.HeadAdditiveBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerHeadAdditiveCurveName());
-	LayeringState.HeadSlotBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerHeadSlotCurveName());
+	LayeringState.HeadBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerHead);
+	LayeringState.HeadAdditiveBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerHeadAdditive);
+	LayeringState.HeadSlotBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerHeadSlot);
 
 	// The mesh space blend will always be 1 unless the local space blend is 1.
 
-	LayeringState.ArmLeftBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmLeftCurveName());
-	LayeringState.ArmLeftAdditiveBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmLeftAdditiveCurveName());
-	LayeringState.ArmLeftSlotBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmLeftSlotCurveName());
-	LayeringState.ArmLeftLocalSpaceBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmLeftLocalSpaceCurveName());
+	LayeringState.ArmLeftBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerArmLeft);
+	LayeringState.ArmLeftAdditiveBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerArmLeftAdditive);
+	LayeringState.ArmLeftSlotBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerArmLeftSlot);
+	LayeringState.ArmLeftLocalSpaceBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerArmLeftLocalSpace);
 	LayeringState.ArmLeftMeshSpaceBlendAmount = !FAnimWeight::IsFullWeight(LayeringState.ArmLeftLocalSpaceBlendAmount);
 
 	// The mesh space blend will always be 1 unless the local space blend is 1.
 
-	LayeringState.ArmRightBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmRightCurveName());
-	LayeringState.ArmRightAdditiveBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmRightAdditiveCurveName());
-	LayeringState.ArmRightSlotBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmRightSlotCurveName());
-	LayeringState.ArmRightLocalSpaceBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerArmRightLocalSpaceCurveName());
+	LayeringState.ArmRightBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerArmRight);
+	LayeringState.ArmRightAdditiveBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerArmRightAdditive);
+	LayeringState.ArmRightSlotBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerArmRightSlot);
+	LayeringState.ArmRightLocalSpaceBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerArmRightLocalSpace);
 	LayeringState.ArmRightMeshSpaceBlendAmount = !FAnimWeight::IsFullWeight(LayeringState.ArmRightLocalSpaceBlendAmount);
 
-	LayeringState.HandLeftBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerHandLeftCurveName());
-	LayeringState.HandRightBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerHandRightCurveName());
+	LayeringState.HandLeftBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerHandLeft);
+	LayeringState.HandRightBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerHandRight);
 
-	LayeringState.SpineBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerSpineCurveName());
-	LayeringState.SpineAdditiveBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerSpineAdditiveCurveName());
-	LayeringState.SpineSlotBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerSpineSlotCurveName());
+	LayeringState.SpineBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerSpine);
+	LayeringState.SpineAdditiveBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerSpineAdditive);
+	LayeringState.SpineSlotBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerSpineSlot);
 
-	LayeringState.PelvisBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerPelvisCurveName());
-	LayeringState.PelvisSlotBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerPelvisSlotCurveName());
+	LayeringState.PelvisBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerPelvis);
+	LayeringState.PelvisSlotBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerPelvisSlot);
 
-	LayeringState.LegsBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerLegsCurveName());
-	LayeringState.LegsSlotBlendAmount = GetCurveValue(Curves, UAlsConstants::LayerLegsSlotCurveName());
+	LayeringState.LegsBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerLegs);
+	LayeringState.LegsSlotBlendAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::LayerLegsSlot);
 }
 
 void UAlsAnimationInstance::RefreshPose()
 {
 	const auto& Curves{GetProxyOnAnyThread<FAlsAnimationInstanceProxy>().GetAnimationCurves(EAnimCurveType::AttributeCurve)};
 
-	static const auto GetCurveValue{
-		[](const TMap<FName, float>& Curves, const FName& CurveName) -> float
-		{
-			const auto* Value{Curves.Find(CurveName)};
-
-			return Value != nullptr ? *Value : 0.0f;
-		}
-	};
+	PoseState.GroundedAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::PoseGrounded);
+	PoseState.InAirAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::PoseInAir);
 
-	PoseState.GroundedAmount = GetCurveValue(Curves, UAlsConstants::PoseGroundedCurveName());
-	PoseState.InAirAmount = GetCurveValue(Curves, UAlsConstants::PoseInAirCurveName());
+	PoseState.StandingAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::PoseStanding);
+	PoseState.CrouchingAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::PoseCrouching);
 
-	PoseState.StandingAmount = GetCurveValue(Curves, UAlsConstants::PoseStandingCurveName());
-	PoseState.CrouchingAmount = GetCurveValue(Curves, UAlsConstants::PoseCrouchingCurveName());
+	PoseState.MovingAmount = CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::PoseMoving);
 
-	PoseState.MovingAmount = GetCurveValue(Curves, UAlsConstants::PoseMovingCurveName());
-
-	PoseState.GaitAmount = FMath::Clamp(GetCurveValue(Curves, UAlsConstants::PoseGaitCurveName()), 0.0f, 3.0f);
+	PoseState.GaitAmount = FMath::Clamp(CurvesCache.GetCurveValue(Curves, AlsAnimationInstanceCurves::PoseGait), 0.0f, 3.0f);
 	PoseState.GaitWalkingAmount = UAlsMath::Clamp01(PoseState.GaitAmount);
 	PoseState.GaitRunningAmount = UAlsMath::Clamp01(PoseState.GaitAmount - 1.0f);
 	PoseState.GaitSprintingAmount = UAlsMath::Clamp01(PoseState.GaitAmount - 2.0f);
@@ -923,9 +1024,10 @@ void UAlsAnimationInstance::RefreshGroundPrediction()
 
 	static constexpr auto VerticalVelocityThreshold{-200.0f};
 
-	if (InAirState.VerticalVelocity > VerticalVelocityThreshold)
+	if (InAirState.VerticalVelocity > VerticalVelocityThreshold || LodLevel >= EAlsLodLevel::Minimal)
 	{
 		InAirState.GroundPredictionAmount = 0.0f;
+		InAirState.bGroundPredictionSweepValid = false;
 		return;
 	}
 
@@ -933,6 +1035,7 @@ void UAlsAnimationInstance::RefreshGroundPrediction()
 	if (AllowanceAmount <= UE_KINDA_SMALL_NUMBER)
 	{
 		InAirState.GroundPredictionAmount = 0.0f;
+		InAirState.bGroundPredictionSweepValid = false;
 		return;
 	}
 
@@ -948,39 +1051,68 @@ void UAlsAnimationInstance::RefreshGroundPrediction()
 	static constexpr auto MinSweepDistance{150.0f};
 	static constexpr auto MaxSweepDistance{2000.0f};
 
-	const auto SweepVector{
-		VelocityDirection * FMath::GetMappedRangeValueClamped(FVector2f{MaxVerticalVelocity, MinVerticalVelocity},
-		                                                      {MinSweepDistance, MaxSweepDistance},
-		                                                      InAirState.VerticalVelocity) * LocomotionState.Scale
+	const auto SweepDistance{
+		FMath::GetMappedRangeValueClamped(FVector2f{MaxVerticalVelocity, MinVerticalVelocity},
+		                                  {MinSweepDistance, MaxSweepDistance},
+		                                  InAirState.VerticalVelocity) * LocomotionState.Scale
 	};
 
+	float SweepTime;
+	bool bGroundValid;
+
+	if (TryExtrapolateGroundPrediction(VelocityDirection, SweepDistance, SweepTime, bGroundValid))
+	{
+#if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
+		if (bDisplayDebugTraces)
+		{
+			const auto SweepEndLocation{SweepStartLocation + VelocityDirection * SweepDistance};
+
+			FHitResult Hit{SweepStartLocation, SweepEndLocation};
+
+			if (bGroundValid)
+			{
+				Hit.bBlockingHit = true;
+				Hit.Time = SweepTime;
+				Hit.Location = SweepStartLocation + VelocityDirection * (SweepDistance * SweepTime);
+				Hit.ImpactPoint = Hit.Location;
+			}
+
+			// Extrapolated results use lighter colors to distinguish them from the actual sweeps.
+
+			DisplayDebugTracesBuffer.AddSweepSingleCapsule(SweepStartLocation, SweepEndLocation, FRotator::ZeroRotator,
+			                                               LocomotionState.CapsuleRadius, LocomotionState.CapsuleHalfHeight,
+			                                               bGroundValid, Hit, {0.5f, 0.5f, 1.0f}, {1.0f, 0.5f, 1.0f});
+		}
+#endif
+
+		InAirState.GroundPredictionAmount = bGroundValid
+			                                    ? Settings->InAir.GroundPredictionAmountCurve->GetFloatValue(SweepTime) * AllowanceAmount
+			                                    : 0.0f;
+		return;
+	}
+
+	const auto SweepVector{VelocityDirection * SweepDistance};
+
 	FHitResult Hit;
 	GetWorld()->SweepSingleByChannel(Hit, SweepStartLocation, SweepStartLocation + SweepVector,
 	                                 FQuat::Identity, Settings->InAir.GroundPredictionSweepChannel,
 	                                 FCollisionShape::MakeCapsule(LocomotionState.CapsuleRadius, LocomotionState.CapsuleHalfHeight),
 	                                 {__FUNCTION__, false, Character}, Settings->InAir.GroundPredictionSweepResponses);
 
-	const auto bGroundValid{Hit.IsValidBlockingHit() && Hit.ImpactNormal.Z >= LocomotionState.WalkableFloorZ};
+	bGroundValid = Hit.IsValidBlockingHit() && Hit.ImpactNormal.Z >= LocomotionState.WalkableFloorZ;
+
+	InAirState.bGroundPredictionSweepValid = Settings->InAir.bDecimateGroundPredictionSweep;
+	InAirState.bGroundPredictionGroundValid = bGroundValid;
+	InAirState.GroundPredictionSweepTime = GetWorld()->GetTimeSeconds();
+	InAirState.GroundPredictionSweepDirection = VelocityDirection;
+	InAirState.GroundPredictionImpactLocation = Hit.Location;
 
 #if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
 	if (bDisplayDebugTraces)
 	{
-		if (IsInGameThread())
-		{
-			UAlsDebugUtility::DrawSweepSingleCapsule(GetWorld(), Hit.TraceStart, Hit.TraceEnd, FRotator::ZeroRotator,
-			                                         LocomotionState.CapsuleRadius, LocomotionState.CapsuleHalfHeight,
-			                                         bGroundValid, Hit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f});
-		}
-		else
-		{
-			DisplayDebugTracesQueue.Emplace([this, Hit, bGroundValid]
-				{
-					UAlsDebugUtility::DrawSweepSingleCapsule(GetWorld(), Hit.TraceStart, Hit.TraceEnd, FRotator::ZeroRotator,
-					                                         LocomotionState.CapsuleRadius, LocomotionState.CapsuleHalfHeight,
-					                                         bGroundValid, Hit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f});
-				}
-			);
-		}
+		DisplayDebugTracesBuffer.AddSweepSingleCapsule(Hit.TraceStart, Hit.TraceEnd, FRotator::ZeroRotator,
+		                                               LocomotionState.CapsuleRadius, LocomotionState.CapsuleHalfHeight,
+		                                               bGroundValid, Hit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f});
 	}
 #endif
 
@@ -989,6 +1121,57 @@ void UAlsAnimationInstance::RefreshGroundPrediction()
 		                                    : 0.0f;
 }
 
+bool UAlsAnimationInstance::TryExtrapolateGroundPrediction(const FVector& SweepDirection, const float SweepDistance,
+                                                           float& SweepTime, bool& bGroundValid) const
+{
+	if (!Settings->InAir.bDecimateGroundPredictionSweep || !InAirState.bGroundPredictionSweepValid ||
+	    GetWorld()->TimeSince(InAirState.GroundPredictionSweepTime) >= Settings->InAir.GroundPredictionSweepInterval ||
+	    (SweepDirection | InAirState.GroundPredictionSweepDirection) <
+	    FMath::Cos(FMath::DegreesToRadians(Settings->InAir.GroundPredictionSweepMaxAngle)))
+	{
+		return false;
+	}
+
+	if (!InAirState.bGroundPredictionGroundValid)
+	{
+		// Assume that there is still no ground ahead until the next sweep.
+
+		SweepTime = 1.0f;
+		bGroundValid = false;
+		return true;
+	}
+
+	if (!TryExtrapolateGroundPredictionSweepTime(LocomotionState.Location, SweepDirection, SweepDistance, LocomotionState.CapsuleRadius,
+	                                             InAirState.GroundPredictionImpactLocation, SweepTime))
+	{
+		return false;
+	}
+
+	bGroundValid = true;
+	return true;
+}
+
+bool UAlsAnimationInstance::TryExtrapolateGroundPredictionSweepTime(const FVector& SweepStartLocation, const FVector& SweepDirection,
+                                                                    const float SweepDistance, const float CapsuleRadius,
+                                                                    const FVector& PreviousImpactLocation, float& SweepTime)
+{
+	// While the velocity direction is almost unchanged, the character moves along its ballistic trajectory
+	// toward the previous impact location, so the time to impact can be found by projecting that location
+	// onto the current sweep. If the impact location is no longer ahead of the character, a new sweep is required.
+
+	const auto ImpactOffset{PreviousImpactLocation - SweepStartLocation};
+	const auto ImpactDistance{UE_REAL_TO_FLOAT(ImpactOffset | SweepDirection)};
+
+	if (ImpactDistance <= 0.0f || ImpactDistance > SweepDistance ||
+	    (ImpactOffset - SweepDirection * ImpactDistance).SizeSquared() > FMath::Square(CapsuleRadius))
+	{
+		return false;
+	}
+
+	SweepTime = ImpactDistance / SweepDistance;
+	return true;
+}
+
 void UAlsAnimationInstance::RefreshInAirLean()
 {
 	// Use the relative velocity direction and amount to determine how much the character should lean
@@ -1027,25 +1210,26 @@ void UAlsAnimationInstance::RefreshFeetOnGameThread()
 {
 	check(IsInGameThread())
 
-	const auto* Mesh{GetSkelMeshComponent()};
-
-	const auto FootLeftTargetTransform{
-		Mesh->GetSocketTransform(Settings->General.bUseFootIkBones
-			                         ? UAlsConstants::FootLeftIkBoneName()
-			                         : UAlsConstants::FootLeftVirtualBoneName())
+	const FName FootTargetBoneNames[]{
+		Settings->General.bUseFootIkBones ? UAlsConstants::FootLeftIkBoneName() : UAlsConstants::FootLeftVirtualBoneName(),
+		Settings->General.bUseFootIkBones ? UAlsConstants::FootRightIkBoneName() : UAlsConstants::FootRightVirtualBoneName()
 	};
 
-	FeetState.Left.TargetLocation = FootLeftTargetTransform.GetLocation();
-	FeetState.Left.TargetRotation = FootLeftTargetTransform.GetRotation();
+	FTransform FootTargetTransforms[UE_ARRAY_COUNT(FootTargetBoneNames)];
 
-	const auto FootRightTargetTransform{
-		Mesh->GetSocketTransform(Settings->General.bUseFootIkBones
-			                         ? UAlsConstants::FootRightIkBoneName()
-			                         : UAlsConstants::FootRightVirtualBoneName())
-	};
+	FeetTargetTransformsCache.GetTransforms(*GetSkelMeshComponent(), FootTargetBoneNames, FootTargetTransforms);
+
+	FeetState.Left.TargetLocation = FootTargetTransforms[0].GetLocation();
+	FeetState.Left.TargetRotation = FootTargetTransforms[0].GetRotation();
 
-	FeetState.Right.TargetLocation = FootRightTargetTransform.GetLocation();
-	FeetState.Right.TargetRotation = FootRightTargetTransform.GetRotation();
+	FeetState.Right.TargetLocation = FootTargetTransforms[1].GetLocation();
+	FeetState.Right.TargetRotation = FootTargetTransforms[1].GetRotation();
+
+	if (Settings->Feet.bUseAsyncIkTraces)
+	{
+		ReceiveFootOffsetTraceOnGameThread(FeetState.LeftOffsetTrace);
+		ReceiveFootOffsetTraceOnGameThread(FeetState.RightOffsetTrace);
+	}
 }
 
 void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
@@ -1057,11 +1241,11 @@ void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
 
 	const auto ComponentTransformInverse{GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform().Inverse()};
 
-	RefreshFoot(FeetState.Left, UAlsConstants::FootLeftIkCurveName(), UAlsConstants::FootLeftLockCurveName(),
-	            Settings->Feet.LeftFootConstraints, ComponentTransformInverse, DeltaTime);
+	RefreshFoot(FeetState.Left, FeetState.LeftOffsetTrace, UAlsConstants::FootLeftIkCurveName(),
+	            UAlsConstants::FootLeftLockCurveName(), Settings->Feet.LeftFootConstraints, ComponentTransformInverse, DeltaTime);
 
-	RefreshFoot(FeetState.Right, UAlsConstants::FootRightIkCurveName(), UAlsConstants::FootRightLockCurveName(),
-	            Settings->Feet.RightFootConstraints, ComponentTransformInverse, DeltaTime);
+	RefreshFoot(FeetState.Right, FeetState.RightOffsetTrace, UAlsConstants::FootRightIkCurveName(),
+	            UAlsConstants::FootRightLockCurveName(), Settings->Feet.RightFootConstraints, ComponentTransformInverse, DeltaTime);
 
 	const auto ScaleInverse{1.0f / LocomotionState.Scale};
 
@@ -1074,8 +1258,9 @@ void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
 	FeetState.bInhibitFootLockForOneFrame = false;
 }
 
-void UAlsAnimationInstance::RefreshFoot(FAlsFootState& FootState, const FName& IkCurveName,
-                                        const FName& LockCurveName, const FAlsFootConstraintsSettings& ConstraintsSettings,
+void UAlsAnimationInstance::RefreshFoot(FAlsFootState& FootState, FAlsFootOffsetTraceState& OffsetTraceState,
+                                        const FName& IkCurveName, const FName& LockCurveName,
+                                        const FAlsFootConstraintsSettings& ConstraintsSettings,
                                         const FTransform& ComponentTransformInverse, const float DeltaTime) const
 {
 	FootState.IkAmount = GetCurveValueClamped01(IkCurveName);
@@ -1090,7 +1275,7 @@ void UAlsAnimationInstance::RefreshFoot(FAlsFootState& FootState, const FName& I
 	RefreshFootLock(FootState, LockCurveName, ComponentTransformInverse, DeltaTime, FinalLocation, FinalRotation);
 
 	const auto PreviousFinalRotation{FinalRotation};
-	RefreshFootOffset(FootState, DeltaTime, FinalLocation, FinalRotation);
+	RefreshFootOffset(FootState, OffsetTraceState, DeltaTime, FinalLocation, FinalRotation);
 
 	// Prevent the foot from assuming an unnatural pose when on a highly
 	// sloped surface by limiting its rotation after applying a foot offset.
@@ -1107,7 +1292,7 @@ void UAlsAnimationInstance::ProcessFootLockTeleport(FAlsFootState& FootState) co
 	// in one frame, since after accepting the teleportation event, the character can still be moved for
 	// some indefinite time, and this must be taken into account in order to avoid foot locking glitches.
 
-	if (bPendingUpdate || GetWorld()->TimeSince(TeleportedTime) > 0.2f ||
+	if (bPendingUpdate || GetWorld()->TimeSince(TeleportedTime) > AlsAnimationInstance::TeleportDuration ||
 	    !FAnimWeight::IsRelevant(FootState.IkAmount * FootState.LockAmount))
 	{
 		return;
@@ -1279,8 +1464,8 @@ void UAlsAnimationInstance::RefreshFootLock(FAlsFootState& FootState, const FNam
 	FinalRotation.Normalize();
 }
 
-void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const float DeltaTime,
-                                              FVector& FinalLocation, FQuat& FinalRotation) const
+void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, FAlsFootOffsetTraceState& OffsetTraceState,
+                                              const float DeltaTime, FVector& FinalLocation, FQuat& FinalRotation) const
 {
 	if (!FAnimWeight::IsRelevant(FootState.IkAmount))
 	{
@@ -1290,7 +1475,9 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 		return;
 	}
 
-	if (LocomotionMode == AlsLocomotionModeTags::InAir)
+	// Foot IK traces are disabled on less significant characters, so foot offsets are faded out the same way as in the air.
+
+	if (LocomotionMode == AlsLocomotionModeTags::InAir || LodLevel >= EAlsLodLevel::Minimal)
 	{
 		FootState.OffsetTargetLocationZ = 0.0f;
 		FootState.OffsetTargetRotation = FQuat::Identity;
@@ -1323,35 +1510,32 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 		FinalLocation.X, FinalLocation.Y, GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform().GetLocation().Z
 	};
 
+	const auto TraceStart{TraceLocation + FVector{0.0f, 0.0f, Settings->Feet.IkTraceDistanceUpward * LocomotionState.Scale}};
+	const auto TraceEnd{TraceLocation - FVector{0.0f, 0.0f, Settings->Feet.IkTraceDistanceDownward * LocomotionState.Scale}};
+
 	FHitResult Hit;
-	GetWorld()->LineTraceSingleByChannel(Hit,
-	                                     TraceLocation + FVector{
-		                                     0.0f, 0.0f, Settings->Feet.IkTraceDistanceUpward * LocomotionState.Scale
-	                                     },
-	                                     TraceLocation - FVector{
-		                                     0.0f, 0.0f, Settings->Feet.IkTraceDistanceDownward * LocomotionState.Scale
-	                                     },
-	                                     Settings->Feet.IkTraceChannel, {__FUNCTION__, true, Character});
+	if (!TryGetAsyncFootOffsetHit(OffsetTraceState, Hit))
+	{
+		GetWorld()->LineTraceSingleByChannel(Hit, TraceStart, TraceEnd, Settings->Feet.IkTraceChannel, {__FUNCTION__, true, Character});
+	}
+
+	if (Settings->Feet.bUseAsyncIkTraces)
+	{
+		// Async traces can't be safely requested from a worker thread, so the
+		// request is stored here and submitted later on the game thread.
+
+		OffsetTraceState.bRequested = true;
+		OffsetTraceState.Start = TraceStart;
+		OffsetTraceState.End = TraceEnd;
+	}
 
 	const auto bGroundValid{Hit.IsValidBlockingHit() && Hit.ImpactNormal.Z >= LocomotionState.WalkableFloorZ};
 
 #if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
 	if (bDisplayDebugTraces)
 	{
-		if (IsInGameThread())
-		{
-			UAlsDebugUtility::DrawLineTraceSingle(GetWorld(), Hit.TraceStart, Hit.TraceEnd, bGroundValid,
-			                                      Hit, {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f});
-		}
-		else
-		{
-			DisplayDebugTracesQueue.Emplace([this, Hit, bGroundValid]
-				{
-					UAlsDebugUtility::DrawLineTraceSingle(GetWorld(), Hit.TraceStart, Hit.TraceEnd, bGroundValid,
-					                                      Hit, {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f});
-				}
-			);
-		}
+		DisplayDebugTracesBuffer.AddLineTraceSingle(Hit.TraceStart, Hit.TraceEnd, bGroundValid,
+		                                            Hit, {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f});
 	}
 #endif
 
@@ -1401,6 +1585,64 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 	FinalRotation = FootState.OffsetRotation * FinalRotation;
 }
 
+void UAlsAnimationInstance::RequestFootOffsetTraceOnGameThread(FAlsFootOffsetTraceState& OffsetTraceState) const
+{
+	check(IsInGameThread())
+
+	if (!OffsetTraceState.bRequested)
+	{
+		return;
+	}
+
+	OffsetTraceState.bRequested = false;
+
+	OffsetTraceState.Handle = GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, OffsetTraceState.Start,
+	                                                              OffsetTraceState.End, Settings->Feet.IkTraceChannel,
+	                                                              {__FUNCTION__, true, Character});
+
+	OffsetTraceState.RequestTime = GetWorld()->GetTimeSeconds();
+}
+
+void UAlsAnimationInstance::ReceiveFootOffsetTraceOnGameThread(FAlsFootOffsetTraceState& OffsetTraceState) const
+{
+	check(IsInGameThread())
+
+	if (!OffsetTraceState.Handle.IsValid())
+	{
+		return;
+	}
+
+	FTraceDatum TraceDatum;
+	if (GetWorld()->QueryTraceData(OffsetTraceState.Handle, TraceDatum))
+	{
+		OffsetTraceState.bHitValid = true;
+		OffsetTraceState.Hit = TraceDatum.OutHits.Num() > 0 ? TraceDatum.OutHits[0] : FHitResult{TraceDatum.Start, TraceDatum.End};
+		OffsetTraceState.HitTime = OffsetTraceState.RequestTime;
+	}
+	else
+	{
+		OffsetTraceState.bHitValid = false;
+	}
+
+	OffsetTraceState.Handle = {};
+}
+
+bool UAlsAnimationInstance::TryGetAsyncFootOffsetHit(const FAlsFootOffsetTraceState& OffsetTraceState, FHitResult& Hit) const
+{
+	// Use a synchronous trace if the async trace result is too old, or if the character has recently
+	// been teleported, since the async trace result is likely to be at a completely different location.
+
+	if (!Settings->Feet.bUseAsyncIkTraces || !OffsetTraceState.bHitValid || bPendingUpdate ||
+	    GetWorld()->TimeSince(OffsetTraceState.HitTime) > Settings->Feet.AsyncIkTraceMaxAge ||
+	    GetWorld()->TimeSince(TeleportedTime) <= AlsAnimationInstance::TeleportDuration)
+	{
+		return false;
+	}
+
+	Hit = OffsetTraceState.Hit;
+	return true;
+}
+
 void UAlsAnimationInstance::ConstraintFootRotation(const FAlsFootConstraintsSettings& ConstraintsSettings,
                                                    const FQuat& ParentRotation, FQuat& Rotation) const
 {
@@ -1572,6 +1814,11 @@ void UAlsAnimationInstance::RefreshDynamicTransitions()
 
 	DynamicTransitionsState.bUpdatedThisFrame = true;
 
+	if (LodLevel >= EAlsLodLevel::Reduced)
+	{
+		return;
+	}
+
 	if (DynamicTransitionsState.FrameDelay > 0)
 	{
 		DynamicTransitionsState.FrameDelay -= 1;
@@ -2,6 +2,7 @@
 
 #include "AlsAnimationInstance.h"
 #include "AlsCharacterMovementComponent.h"
+#include "AlsSignificanceSubsystem.h"
 #include "TimerManager.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -88,6 +89,7 @@ void AAlsCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLif
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, DesiredRotationMode, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ViewMode, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, OverlayMode, Parameters)
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, NetworkLodLevel, Parameters)
 
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ReplicatedViewRotation, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, InputDirection, Parameters)
@@ -113,12 +115,12 @@ void AAlsCharacter::PostRegisterAllComponents()
 
 	SetReplicatedViewRotation(Super::GetViewRotation().GetNormalized(), false);
 
-	ViewState.NetworkSmoothing.InitialRotation = ReplicatedViewRotation;
-	ViewState.NetworkSmoothing.TargetRotation = ReplicatedViewRotation;
-	ViewState.NetworkSmoothing.CurrentRotation = ReplicatedViewRotation;
+	ViewState.NetworkSmoothing.InitialRotation = LocalViewRotation;
+	ViewState.NetworkSmoothing.TargetRotation = LocalViewRotation;
+	ViewState.NetworkSmoothing.CurrentRotation = LocalViewRotation;
 
-	ViewState.Rotation = ReplicatedViewRotation;
-	ViewState.PreviousYawAngle = UE_REAL_TO_FLOAT(ReplicatedViewRotation.Yaw);
+	ViewState.Rotation = LocalViewRotation;
+	ViewState.PreviousYawAngle = UE_REAL_TO_FLOAT(LocalViewRotation.Yaw);
 
 	const auto& ActorTransform{GetActorTransform()};
 
@@ -193,6 +195,32 @@ void AAlsCharacter::BeginPlay()
 	AlsCharacterMovement->SetRotationMode(RotationMode);
 
 	OnOverlayModeChanged(OverlayMode);
+
+	// Capture the network update frequency after Super::BeginPlay(), so that changes made in blueprints are taken into account.
+
+	BaseNetUpdateFrequency = NetUpdateFrequency;
+
+	if (IsValid(Settings) && (Settings->Lod.bEnableLod || Settings->Lod.bEnableNetworkLod))
+	{
+		auto* SignificanceSubsystem{GetWorld()->GetSubsystem<UAlsSignificanceSubsystem>()};
+		if (IsValid(SignificanceSubsystem))
+		{
+			SignificanceSubsystem->RegisterCharacter(this);
+		}
+	}
+}
+
+void AAlsCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	auto* SignificanceSubsystem{GetWorld()->GetSubsystem<UAlsSignificanceSubsystem>()};
+	if (IsValid(SignificanceSubsystem))
+	{
+		SignificanceSubsystem->UnregisterCharacter(this);
+	}
+
+	LodLevel = EAlsLodLevel::Full;
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AAlsCharacter::CalcCamera(const float DeltaTime, FMinimalViewInfo& ViewInfo)
@@ -440,6 +468,80 @@ void AAlsCharacter::RefreshMovementBase()
 		                             : FRotator::ZeroRotator;
 }
 
+void AAlsCharacter::SetNetworkLodLevel(const EAlsLodLevel NewNetworkLodLevel)
+{
+	if (NetworkLodLevel == NewNetworkLodLevel)
+	{
+		return;
+	}
+
+	NetworkLodLevel = NewNetworkLodLevel;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, NetworkLodLevel, this)
+
+	RefreshNetUpdateFrequency();
+}
+
+void AAlsCharacter::SetBaseNetUpdateFrequency(const float NewBaseNetUpdateFrequency)
+{
+	BaseNetUpdateFrequency = FMath::Max(0.0f, NewBaseNetUpdateFrequency);
+
+	RefreshNetUpdateFrequency();
+}
+
+void AAlsCharacter::RefreshNetUpdateFrequency()
+{
+	// Scale the network update frequency from the base value, so that repeated level changes don't accumulate.
+
+	NetUpdateFrequency = IsValid(Settings)
+		                     ? FMath::Max(BaseNetUpdateFrequency * Settings->Lod.GetNetworkLodScale(NetworkLodLevel),
+		                                  MinNetUpdateFrequency)
+		                     : BaseNetUpdateFrequency;
+}
+
+void AAlsCharacter::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	// Simulated proxies extrapolate the view rotation at the minimal network LOD level, so there is no need to replicate it.
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(ThisClass, ReplicatedViewRotation, NetworkLodLevel < EAlsLodLevel::Minimal)
+}
+
+float AAlsCharacter::GetNetPriority(const FVector& ViewLocation, const FVector& ViewDirection, AActor* Viewer, AActor* ViewTarget,
+                                    UActorChannel* Channel, const float Time, const bool bLowBandwidth)
+{
+	auto Priority{Super::GetNetPriority(ViewLocation, ViewDirection, Viewer, ViewTarget, Channel, Time, bLowBandwidth)};
+
+	// Super::GetNetPriority() already lowers the priority for viewers that are looking away from the
+	// character, so here we only need to lower it further for viewers that are far from the character.
+
+	if (IsValid(Settings) && Settings->Lod.bEnableNetworkLod && ViewTarget != this && Viewer != GetController())
+	{
+		const auto ViewDistanceSquared{UE_REAL_TO_FLOAT(FVector::DistSquared(GetActorLocation(), ViewLocation))};
+
+		Priority *= Settings->Lod.GetNetworkLodScale(UAlsSignificanceSubsystem::CalculateNetworkLodLevel(
+			Settings->Lod, ViewDistanceSquared));
+	}
+
+	return Priority;
+}
+
+void AAlsCharacter::OnReplicated_NetworkLodLevel()
+{
+	auto& NetworkSmoothing{ViewState.NetworkSmoothing};
+
+	const auto bExtrapolate{NetworkLodLevel >= EAlsLodLevel::Minimal};
+
+	if (bExtrapolate && !NetworkSmoothing.bExtrapolating)
+	{
+		NetworkSmoothing.ExtrapolationYawOffset = FRotator3f::NormalizeAxis(
+			UE_REAL_TO_FLOAT(NetworkSmoothing.CurrentRotation.Yaw - GetActorRotation().Yaw));
+	}
+
+	NetworkSmoothing.bExtrapolating = bExtrapolate;
+}
+
 void AAlsCharacter::SetViewMode(const FGameplayTag& NewViewMode)
 {
 	SetViewMode(NewViewMode, true);
@@ -1146,9 +1248,31 @@ void AAlsCharacter::RefreshInput(const float DeltaTime)
 
 void AAlsCharacter::SetReplicatedViewRotation(const FRotator& NewViewRotation, const bool bSendRpc)
 {
-	if (!ReplicatedViewRotation.Equals(NewViewRotation))
+	LocalViewRotation = NewViewRotation;
+
+	FAlsReplicatedViewRotation NewReplicatedViewRotation;
+	NewReplicatedViewRotation.Rotation = NewViewRotation;
+
+	auto SendThreshold{UE_KINDA_SMALL_NUMBER};
+
+	if (IsValid(Settings))
 	{
-		ReplicatedViewRotation = NewViewRotation;
+		if (Settings->View.bQuantizeReplicatedViewRotation)
+		{
+			NewReplicatedViewRotation.AxisBitsCount = static_cast<uint8>(
+				FMath::Clamp(Settings->View.ReplicatedViewRotationAxisBitsCount, 1, FAlsReplicatedViewRotation::MaxAxisBitsCount));
+
+			NewReplicatedViewRotation.Rotation = FAlsReplicatedViewRotation::Quantize(NewViewRotation,
+			                                                                          NewReplicatedViewRotation.AxisBitsCount);
+		}
+
+		SendThreshold = FMath::Max(SendThreshold, Settings->View.ReplicatedViewRotationSendThreshold);
+	}
+
+	if (ReplicatedViewRotation.AxisBitsCount != NewReplicatedViewRotation.AxisBitsCount ||
+	    !ReplicatedViewRotation.Rotation.Equals(NewReplicatedViewRotation.Rotation, SendThreshold))
+	{
+		ReplicatedViewRotation = NewReplicatedViewRotation;
 
 		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ReplicatedViewRotation, this)
 
@@ -1159,14 +1283,16 @@ void AAlsCharacter::SetReplicatedViewRotation(const FRotator& NewViewRotation, c
 	}
 }
 
-void AAlsCharacter::ServerSetReplicatedViewRotation_Implementation(const FRotator& NewViewRotation)
+void AAlsCharacter::ServerSetReplicatedViewRotation_Implementation(const FAlsReplicatedViewRotation& NewViewRotation)
 {
-	SetReplicatedViewRotation(NewViewRotation, false);
+	SetReplicatedViewRotation(NewViewRotation.Rotation, false);
 }
 
 void AAlsCharacter::OnReplicated_ReplicatedViewRotation()
 {
-	CorrectViewNetworkSmoothing(ReplicatedViewRotation, MovementBase.bHasRelativeRotation);
+	LocalViewRotation = ReplicatedViewRotation.Rotation;
+
+	CorrectViewNetworkSmoothing(ReplicatedViewRotation.Rotation, MovementBase.bHasRelativeRotation);
 }
 
 void AAlsCharacter::CorrectViewNetworkSmoothing(const FRotator& NewTargetRotation, const bool bRotationIsBaseRelative)
@@ -1264,16 +1390,41 @@ void AAlsCharacter::RefreshView(const float DeltaTime)
 		}
 	}
 
-	RefreshViewNetworkSmoothing(DeltaTime);
+	auto& NetworkSmoothing{ViewState.NetworkSmoothing};
+
+	// The time over which the view rotation has changed since its last refresh.
+	auto RotationDeltaTime{DeltaTime};
+
+	if (LodLevel >= EAlsLodLevel::Reduced && !MovementBase.bHasRelativeRotation && !NetworkSmoothing.bSkippedPreviousFrame)
+	{
+		// Less significant characters refresh network smoothing at half rate. Skipping is not
+		// allowed on movement bases, since the rotations must be offset by the base every frame.
+
+		NetworkSmoothing.SkippedTime += DeltaTime;
+		NetworkSmoothing.bSkippedPreviousFrame = true;
 
-	ViewState.Rotation = ViewState.NetworkSmoothing.CurrentRotation;
+		// The view rotation doesn't change on skipped frames, so keep the previous yaw speed.
+
+		RotationDeltaTime = 0.0f;
+	}
+	else
+	{
+		RotationDeltaTime += NetworkSmoothing.SkippedTime;
+
+		RefreshViewNetworkSmoothing(RotationDeltaTime);
+
+		NetworkSmoothing.SkippedTime = 0.0f;
+		NetworkSmoothing.bSkippedPreviousFrame = false;
+	}
+
+	ViewState.Rotation = NetworkSmoothing.CurrentRotation;
 
 	// Set the yaw speed by comparing the current and previous view yaw angle, divided by
 	// delta seconds. This represents the speed the camera is rotating from left to right.
 
-	if (DeltaTime > UE_SMALL_NUMBER)
+	if (RotationDeltaTime > UE_SMALL_NUMBER)
 	{
-		ViewState.YawSpeed = FMath::Abs(UE_REAL_TO_FLOAT(ViewState.Rotation.Yaw - ViewState.PreviousYawAngle)) / DeltaTime;
+		ViewState.YawSpeed = FMath::Abs(UE_REAL_TO_FLOAT(ViewState.Rotation.Yaw - ViewState.PreviousYawAngle)) / RotationDeltaTime;
 	}
 }
 
@@ -1284,6 +1435,20 @@ void AAlsCharacter::RefreshViewNetworkSmoothing(const float DeltaTime)
 
 	auto& NetworkSmoothing{ViewState.NetworkSmoothing};
 
+	if (NetworkSmoothing.bExtrapolating)
+	{
+		// The view rotation is not replicated at the current network LOD level, so keep it facing the same direction relative
+		// to the character, which looks much more natural in animations than a view rotation that is frozen in world space.
+
+		NetworkSmoothing.CurrentRotation.Yaw = FRotator::NormalizeAxis(GetActorRotation().Yaw + NetworkSmoothing.ExtrapolationYawOffset);
+
+		NetworkSmoothing.InitialRotation = NetworkSmoothing.CurrentRotation;
+		NetworkSmoothing.TargetRotation = NetworkSmoothing.CurrentRotation;
+		NetworkSmoothing.ClientTime = NetworkSmoothing.ServerTime;
+
+		return;
+	}
+
 	if (!NetworkSmoothing.bEnabled ||
 	    NetworkSmoothing.ClientTime >= NetworkSmoothing.ServerTime ||
 	    NetworkSmoothing.Duration <= UE_SMALL_NUMBER ||
@@ -1293,8 +1458,8 @@ void AAlsCharacter::RefreshViewNetworkSmoothing(const float DeltaTime)
 		// is standing on a rotating object, as it causes constant rotation jitter.
 
 		NetworkSmoothing.InitialRotation = MovementBase.bHasRelativeRotation
-			                                   ? (MovementBase.Rotation * ReplicatedViewRotation.Quaternion()).Rotator()
-			                                   : ReplicatedViewRotation;
+			                                   ? (MovementBase.Rotation * LocalViewRotation.Quaternion()).Rotator()
+			                                   : LocalViewRotation;
 
 		NetworkSmoothing.TargetRotation = NetworkSmoothing.InitialRotation;
 		NetworkSmoothing.CurrentRotation = NetworkSmoothing.InitialRotation;
@@ -1712,13 +1877,14 @@ float AAlsCharacter::CalculateGroundedMovingRotationInterpolationSpeed() const
 	// the curve in conjunction with the gait amount gives you a high level of control over the rotation
 	// rates for each speed. Increase the speed if the camera is rotating quickly for more responsive rotation.
 
-	const auto* InterpolationSpeedCurve{AlsCharacterMovement->GetGaitSettings().RotationInterpolationSpeedCurve.Get()};
+	const auto& GaitSettings{AlsCharacterMovement->GetGaitSettings()};
 
 	static constexpr auto DefaultInterpolationSpeed{5.0f};
 
 	const auto InterpolationSpeed{
-		ALS_ENSURE(IsValid(InterpolationSpeedCurve))
-			? InterpolationSpeedCurve->GetFloatValue(AlsCharacterMovement->CalculateGaitAmount())
+		ALS_ENSURE(IsValid(GaitSettings.RotationInterpolationSpeedCurve))
+			? GaitSettings.GetRotationInterpolationSpeedByGaitAmount(AlsCharacterMovement->CalculateGaitAmount(),
+			                                                         AlsCharacterMovement->GetBakedGaitCurves())
 			: DefaultInterpolationSpeed
 	};
 
@@ -27,9 +27,9 @@ bool FAlsCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Moveme
 {
 	Super::Serialize(Movement, Archive, Map, MoveType);
 
-	NetSerializeOptionalValue(Archive.IsSaving(), Archive, RotationMode, AlsRotationModeTags::ViewDirection.GetTag(), Map);
-	NetSerializeOptionalValue(Archive.IsSaving(), Archive, Stance, AlsStanceTags::Standing.GetTag(), Map);
-	NetSerializeOptionalValue(Archive.IsSaving(), Archive, MaxAllowedGait, AlsGaitTags::Walking.GetTag(), Map);
+	AlsMovementSettingsIndices::NetSerializeRotationMode(Archive, Map, RotationMode);
+	AlsMovementSettingsIndices::NetSerializeStance(Archive, Map, Stance);
+	AlsMovementSettingsIndices::NetSerializeGait(Archive, Map, MaxAllowedGait);
 
 	return !Archive.IsError();
 }
@@ -283,7 +283,7 @@ float UAlsCharacterMovementComponent::GetMaxAcceleration() const
 	// Get the acceleration using the movement curve. This allows for fine control over movement behavior at each speed.
 
 	return IsMovingOnGround() && ALS_ENSURE(IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve))
-		       ? GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[0].Eval(CalculateGaitAmount())
+		       ? GaitSettings.GetAccelerationByGaitAmount(CalculateGaitAmount(), GetBakedGaitCurves())
 		       : Super::GetMaxAcceleration();
 }
 
@@ -292,7 +292,7 @@ float UAlsCharacterMovementComponent::GetMaxBrakingDeceleration() const
 	// Get the deceleration using the movement curve. This allows for fine control over movement behavior at each speed.
 
 	return IsMovingOnGround() && ALS_ENSURE(IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve))
-		       ? GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[1].Eval(CalculateGaitAmount())
+		       ? GaitSettings.GetDecelerationByGaitAmount(CalculateGaitAmount(), GetBakedGaitCurves())
 		       : Super::GetMaxBrakingDeceleration();
 }
 
@@ -323,7 +323,7 @@ void UAlsCharacterMovementComponent::PhysWalking(const float DeltaTime, int32 It
 	{
 		// Get the ground friction using the movement curve. This allows for fine control over movement behavior at each speed.
 
-		GroundFriction = GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[2].Eval(CalculateGaitAmount());
+		GroundFriction = GaitSettings.GetGroundFrictionByGaitAmount(CalculateGaitAmount(), GetBakedGaitCurves());
 	}
 
 	// TODO Copied with modifications from UCharacterMovementComponent::PhysWalking(). After the
@@ -582,7 +582,7 @@ void UAlsCharacterMovementComponent::PhysNavWalking(const float DeltaTime, const
 	{
 		// Get the ground friction using the movement curve. This allows for fine control over movement behavior at each speed.
 
-		GroundFriction = GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[2].Eval(CalculateGaitAmount());
+		GroundFriction = GaitSettings.GetGroundFrictionByGaitAmount(CalculateGaitAmount(), GetBakedGaitCurves());
 	}
 
 	Super::PhysNavWalking(DeltaTime, Iterations);
@@ -894,8 +894,7 @@ void UAlsCharacterMovementComponent::RefreshGaitSettings()
 {
 	if (ALS_ENSURE(IsValid(MovementSettings)))
 	{
-		const auto* StanceSettings{MovementSettings->RotationModes.Find(RotationMode)};
-		const auto* NewGaitSettings{ALS_ENSURE(StanceSettings != nullptr) ? StanceSettings->Stances.Find(Stance) : nullptr};
+		const auto* NewGaitSettings{MovementSettings->FindGaitSettings(RotationMode, Stance)};
 
 		GaitSettings = ALS_ENSURE(NewGaitSettings != nullptr) ? *NewGaitSettings : FAlsMovementGaitSettings{};
 	}
@@ -15,10 +15,12 @@
 #include "Utility/AlsDebugUtility.h"
 #include "Utility/AlsLog.h"
 #include "Utility/AlsMacros.h"
-#include "Utility/AlsMontageUtility.h"
 #include "Utility/AlsRotation.h"
+#include "Utility/AlsUtility.h"
 #include "Utility/AlsVector.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ragdoll Motors Updates Skipped"), STAT_AlsRagdollMotorsUpdatesSkipped, STATGROUP_Als)
+
 void AAlsCharacter::StartRolling(const float PlayRate)
 {
 	if (LocomotionMode == AlsLocomotionModeTags::Grounded)
@@ -50,18 +52,28 @@ void AAlsCharacter::StartRolling(const float PlayRate, const float TargetYawAngl
 		return;
 	}
 
-	const auto InitialYawAngle{UE_REAL_TO_FLOAT(FRotator::NormalizeAxis(GetActorRotation().Yaw))};
+	// Use the parameters exactly as the server and remote sides receive them, otherwise
+	// the montage timing and root motion diverge between them and cause corrections.
+
+	FAlsRollingParameters Parameters;
+
+	Parameters.PlayRate = FAlsRollingParameters::DequantizePlayRate(FAlsRollingParameters::QuantizePlayRate(PlayRate));
+
+	Parameters.InitialYawAngle = FAlsRollingParameters::DequantizeYawAngle(
+		FAlsRollingParameters::QuantizeYawAngle(UE_REAL_TO_FLOAT(GetActorRotation().Yaw)));
+
+	Parameters.TargetYawAngle = FAlsRollingParameters::DequantizeYawAngle(FAlsRollingParameters::QuantizeYawAngle(TargetYawAngle));
 
 	if (GetLocalRole() >= ROLE_Authority)
 	{
-		MulticastStartRolling(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
+		MulticastStartRolling(Montage, Parameters);
 	}
 	else
 	{
 		GetCharacterMovement()->FlushServerMoves();
 
-		StartRollingImplementation(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
-		ServerStartRolling(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
+		StartRollingImplementation(Montage, Parameters);
+		ServerStartRolling(Montage, Parameters);
 	}
 }
 
@@ -70,30 +82,27 @@ UAnimMontage* AAlsCharacter::SelectRollMontage_Implementation()
 	return Settings->Rolling.Montage;
 }
 
-void AAlsCharacter::ServerStartRolling_Implementation(UAnimMontage* Montage, const float PlayRate,
-                                                      const float InitialYawAngle, const float TargetYawAngle)
+void AAlsCharacter::ServerStartRolling_Implementation(UAnimMontage* Montage, const FAlsRollingParameters& Parameters)
 {
 	if (IsRollingAllowedToStart(Montage))
 	{
-		MulticastStartRolling(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
+		MulticastStartRolling(Montage, Parameters);
 		ForceNetUpdate();
 	}
 }
 
-void AAlsCharacter::MulticastStartRolling_Implementation(UAnimMontage* Montage, const float PlayRate,
-                                                         const float InitialYawAngle, const float TargetYawAngle)
+void AAlsCharacter::MulticastStartRolling_Implementation(UAnimMontage* Montage, const FAlsRollingParameters& Parameters)
 {
-	StartRollingImplementation(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
+	StartRollingImplementation(Montage, Parameters);
 }
 
-void AAlsCharacter::StartRollingImplementation(UAnimMontage* Montage, const float PlayRate,
-                                               const float InitialYawAngle, const float TargetYawAngle)
+void AAlsCharacter::StartRollingImplementation(UAnimMontage* Montage, const FAlsRollingParameters& Parameters)
 {
-	if (IsRollingAllowedToStart(Montage) && GetMesh()->GetAnimInstance()->Montage_Play(Montage, PlayRate) > 0.0f)
+	if (IsRollingAllowedToStart(Montage) && GetMesh()->GetAnimInstance()->Montage_Play(Montage, Parameters.PlayRate) > 0.0f)
 	{
-		RollingState.TargetYawAngle = TargetYawAngle;
+		RollingState.TargetYawAngle = Parameters.TargetYawAngle;
 
-		SetRotationInstant(InitialYawAngle);
+		SetRotationInstant(Parameters.InitialYawAngle);
 
 		SetLocomotionAction(AlsLocomotionActionTags::Rolling);
 	}
@@ -145,8 +154,22 @@ bool AAlsCharacter::StartMantlingGrounded()
 
 bool AAlsCharacter::StartMantlingInAir()
 {
-	return LocomotionMode == AlsLocomotionModeTags::InAir && IsLocallyControlled() &&
-	       StartMantling(Settings->Mantling.InAirTrace);
+	if (LocomotionMode != AlsLocomotionModeTags::InAir || !IsLocallyControlled())
+	{
+		return false;
+	}
+
+	// Limit the rate of in-air mantling attempts, since they are performed continuously while the character is in the air.
+
+	const auto WorldTime{GetWorld()->GetTimeSeconds()};
+	if (WorldTime < MantlingState.NextInAirTraceTime)
+	{
+		return false;
+	}
+
+	MantlingState.NextInAirTraceTime = WorldTime + Settings->Mantling.InAirTraceInterval;
+
+	return StartMantling(Settings->Mantling.InAirTrace);
 }
 
 bool AAlsCharacter::IsMantlingAllowedToStart_Implementation() const
@@ -184,13 +207,53 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 		return false;
 	}
 
-	const auto ForwardTraceDirection{
-		UAlsVector::AngleToDirectionXY(
-			ActorYawAngle + FMath::ClampAngle(ForwardTraceDeltaAngle, -Settings->Mantling.MaxReachAngle, Settings->Mantling.MaxReachAngle))
+	const auto ForwardTraceYawAngle{
+		ActorYawAngle + FMath::ClampAngle(ForwardTraceDeltaAngle, -Settings->Mantling.MaxReachAngle, Settings->Mantling.MaxReachAngle)
+	};
+
+	const auto ForwardTraceDirection{UAlsVector::AngleToDirectionXY(ForwardTraceYawAngle)};
+
+	// In-air mantling attempts that failed recently at roughly the same location and in roughly
+	// the same direction are rejected right away, since they will most likely fail again.
+
+	const auto bCacheRejectedTraces{
+		LocomotionMode == AlsLocomotionModeTags::InAir && Settings->Mantling.InAirRejectedTraceCacheDuration > 0.0f
+	};
+
+	static constexpr auto DirectionSectorAngle{360.0f / 16.0f};
+
+	const auto LocationCellInverseSize{1.0f / FMath::Max(1.0f, Settings->Mantling.InAirRejectedTraceCacheCellSize)};
+
+	const FIntVector LocationCell{
+		FMath::FloorToInt32(ActorLocation.X * LocationCellInverseSize),
+		FMath::FloorToInt32(ActorLocation.Y * LocationCellInverseSize),
+		FMath::FloorToInt32(ActorLocation.Z * LocationCellInverseSize)
+	};
+
+	const auto DirectionSector{FMath::RoundToInt(FRotator3f::ClampAxis(ForwardTraceYawAngle) / DirectionSectorAngle) % 16};
+
+	if (bCacheRejectedTraces && IsInAirMantlingTraceRejected(LocationCell, DirectionSector))
+	{
+		return false;
+	}
+
+	auto bRejected{true};
+
+	ON_SCOPE_EXIT
+	{
+		if (bCacheRejectedTraces && bRejected)
+		{
+			RejectInAirMantlingTrace(LocationCell, DirectionSector);
+		}
 	};
 
 #if ENABLE_DRAW_DEBUG
 	const auto bDisplayDebug{UAlsDebugUtility::ShouldDisplayDebugForActor(this, UAlsConstants::MantlingDebugDisplayName())};
+
+	ON_SCOPE_EXIT
+	{
+		DisplayDebugTracesBuffer.Flush(GetWorld());
+	};
 #endif
 
 	const auto* Capsule{GetCapsuleComponent()};
@@ -234,9 +297,10 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 #if ENABLE_DRAW_DEBUG
 		if (bDisplayDebug)
 		{
-			UAlsDebugUtility::DrawSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-			                                                    ForwardTraceCapsuleHalfHeight, false, ForwardTraceHit, {0.0f, 0.25f, 1.0f},
-			                                                    {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
+			DisplayDebugTracesBuffer.AddSweepSingleCapsuleAlternative(ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
+			                                                          ForwardTraceCapsuleHalfHeight, false, ForwardTraceHit,
+			                                                          {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f},
+			                                                          TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
 		}
 #endif
 
@@ -287,13 +351,14 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 #if ENABLE_DRAW_DEBUG
 		if (bDisplayDebug)
 		{
-			UAlsDebugUtility::DrawSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-			                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit, {0.0f, 0.25f, 1.0f},
-			                                                    {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
-
-			UAlsDebugUtility::DrawSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
-			                                        false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
-			                                        TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
+			DisplayDebugTracesBuffer.AddSweepSingleCapsuleAlternative(ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
+			                                                          ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit,
+			                                                          {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f},
+			                                                          TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
+
+			DisplayDebugTracesBuffer.AddSweepSingleSphere(DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
+			                                              false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
+			                                              TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
 		}
 #endif
 
@@ -319,13 +384,14 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 #if ENABLE_DRAW_DEBUG
 		if (bDisplayDebug)
 		{
-			UAlsDebugUtility::DrawSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-			                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit, {0.0f, 0.25f, 1.0f},
-			                                                    {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
+			DisplayDebugTracesBuffer.AddSweepSingleCapsuleAlternative(ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
+			                                                          ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit,
+			                                                          {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f},
+			                                                          TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
 
-			UAlsDebugUtility::DrawSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
-			                                        false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
-			                                        TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
+			DisplayDebugTracesBuffer.AddSweepSingleSphere(DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
+			                                              false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
+			                                              TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
 
 			DrawDebugCapsule(GetWorld(), TargetCapsuleLocation, CapsuleHalfHeight, CapsuleRadius, FQuat::Identity,
 			                 FColor::Red, false, TraceSettings.bDrawFailedTraces ? 10.0f : 0.0f);
@@ -359,14 +425,14 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 #if ENABLE_DRAW_DEBUG
 		if (bDisplayDebug)
 		{
-			UAlsDebugUtility::DrawSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-			                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit,
-			                                                    {0.0f, 0.25f, 1.0f},
-			                                                    {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
+			DisplayDebugTracesBuffer.AddSweepSingleCapsuleAlternative(ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
+			                                                          ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit,
+			                                                          {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f},
+			                                                          TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
 
-			UAlsDebugUtility::DrawSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
-			                                        false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
-			                                        TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
+			DisplayDebugTracesBuffer.AddSweepSingleSphere(DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
+			                                              false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
+			                                              TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
 
 			DrawDebugCapsule(GetWorld(), StartLocation, StartLocationTraceCapsuleHalfHeight, TraceCapsuleRadius, FQuat::Identity,
 			                 FLinearColor{1.0f, 0.5f, 0.0f}.ToFColor(true), false, TraceSettings.bDrawFailedTraces ? 10.0f : 0.0f);
@@ -379,16 +445,18 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 #if ENABLE_DRAW_DEBUG
 	if (bDisplayDebug)
 	{
-		UAlsDebugUtility::DrawSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-		                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit,
-		                                                    {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f}, 5.0f);
+		DisplayDebugTracesBuffer.AddSweepSingleCapsuleAlternative(ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
+		                                                          ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit,
+		                                                          {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f}, 5.0f);
 
-		UAlsDebugUtility::DrawSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd,
-		                                        TraceCapsuleRadius, true, DownwardTraceHit,
-		                                        {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f}, 7.5f);
+		DisplayDebugTracesBuffer.AddSweepSingleSphere(DownwardTraceStart, DownwardTraceEnd,
+		                                              TraceCapsuleRadius, true, DownwardTraceHit,
+		                                              {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f}, 7.5f);
 	}
 #endif
 
+	bRejected = false;
+
 	const auto TargetRotation{TargetDirection.ToOrientationQuat()};
 
 	FAlsMantlingParameters Parameters;
@@ -437,6 +505,55 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 	return true;
 }
 
+bool AAlsCharacter::IsInAirMantlingTraceRejected(const FIntVector& LocationCell, const int32 DirectionSector) const
+{
+	const auto MinTime{GetWorld()->GetTimeSeconds() - Settings->Mantling.InAirRejectedTraceCacheDuration};
+
+	for (const auto& RejectedTrace : MantlingState.RejectedInAirTraces)
+	{
+		if (RejectedTrace.Time >= MinTime && RejectedTrace.DirectionSector == DirectionSector && RejectedTrace.LocationCell == LocationCell)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void AAlsCharacter::RejectInAirMantlingTrace(const FIntVector& LocationCell, const int32 DirectionSector)
+{
+	static constexpr auto MaxRejectedTraces{8};
+
+	const auto WorldTime{GetWorld()->GetTimeSeconds()};
+	const auto MinTime{WorldTime - Settings->Mantling.InAirRejectedTraceCacheDuration};
+
+	auto& RejectedTraces{MantlingState.RejectedInAirTraces};
+
+	RejectedTraces.RemoveAllSwap([MinTime](const FAlsRejectedMantlingTrace& RejectedTrace)
+	{
+		return RejectedTrace.Time < MinTime;
+	});
+
+	if (RejectedTraces.Num() >= MaxRejectedTraces)
+	{
+		// Replace the oldest rejected trace.
+
+		auto OldestIndex{0};
+
+		for (auto i{1}; i < RejectedTraces.Num(); i++)
+		{
+			if (RejectedTraces[i].Time < RejectedTraces[OldestIndex].Time)
+			{
+				OldestIndex = i;
+			}
+		}
+
+		RejectedTraces.RemoveAtSwap(OldestIndex, 1, false);
+	}
+
+	RejectedTraces.Add({LocationCell, DirectionSector, WorldTime});
+}
+
 void AAlsCharacter::ServerStartMantling_Implementation(const FAlsMantlingParameters& Parameters)
 {
 	if (IsMantlingAllowedToStart())
@@ -469,7 +586,7 @@ void AAlsCharacter::StartMantlingImplementation(const FAlsMantlingParameters& Pa
 	const auto Duration{MantlingSettings->Montage->GetPlayLength() - StartTime};
 	const auto PlayRate{MantlingSettings->Montage->RateScale};
 
-	const auto TargetAnimationLocation{UAlsMontageUtility::ExtractLastRootTransformFromMontage(MantlingSettings->Montage).GetLocation()};
+	const auto TargetAnimationLocation{MantlingSettings->GetLastRootMotionLocation()};
 
 	if (FMath::IsNearlyZero(TargetAnimationLocation.Z))
 	{
@@ -551,56 +668,19 @@ float AAlsCharacter::CalculateMantlingStartTime(const UAlsMantlingSettings* Mant
 
 	// https://landelare.github.io/2022/05/15/climbing-with-root-motion.html
 
-	const auto* Montage{MantlingSettings->Montage.Get()};
-	if (!IsValid(Montage))
+	if (!IsValid(MantlingSettings->Montage))
 	{
 		return 0.0f;
 	}
 
-	const auto MontageFrameRate{1.0f / Montage->GetSamplingFrameRate().AsDecimal()};
-
-	auto SearchStartTime{0.0f};
-	auto SearchEndTime{Montage->GetPlayLength()};
-
-	const auto SearchStartLocationZ{UAlsMontageUtility::ExtractRootTransformFromMontage(Montage, SearchStartTime).GetTranslation().Z};
-	const auto SearchEndLocationZ{UAlsMontageUtility::ExtractRootTransformFromMontage(Montage, SearchEndTime).GetTranslation().Z};
-
-	// Find the vertical distance the character has already moved.
-
-	const auto TargetLocationZ{FMath::Max(0.0f, SearchEndLocationZ - MantlingHeight)};
-
-	// Perform a binary search to find the time when the character is at the target vertical distance.
-
-	static constexpr auto MaxLocationSearchTolerance{1.0f};
-
-	if (FMath::IsNearlyEqual(SearchStartLocationZ, TargetLocationZ, MaxLocationSearchTolerance))
-	{
-		return SearchStartTime;
-	}
-
-	while (true)
-	{
-		const auto Time{(SearchStartTime + SearchEndTime) * 0.5f};
-		const auto LocationZ{UAlsMontageUtility::ExtractRootTransformFromMontage(Montage, Time).GetTranslation().Z};
-
-		// Stop the search if a close enough location has been found or if
-		// the search interval is less than the animation montage frame rate.
+	// Find the vertical distance the character has already moved, and then find the time when the character is at
+	// this vertical distance. Root motion locations are sampled in advance, so this doesn't require any extraction.
 
-		if (FMath::IsNearlyEqual(LocationZ, TargetLocationZ, MaxLocationSearchTolerance) ||
-		    SearchEndTime - SearchStartTime <= MontageFrameRate)
-		{
-			return Time;
-		}
+	const auto TargetLocationZ{
+		FMath::Max(0.0f, UE_REAL_TO_FLOAT(MantlingSettings->GetLastRootMotionLocation().Z) - MantlingHeight)
+	};
 
-		if (LocationZ < TargetLocationZ)
-		{
-			SearchStartTime = Time;
-		}
-		else
-		{
-			SearchEndTime = Time;
-		}
-	}
+	return MantlingSettings->FindRootMotionTimeByLocationZ(TargetLocationZ);
 }
 
 void AAlsCharacter::OnMantlingStarted_Implementation(const FAlsMantlingParameters& Parameters) {}
@@ -765,6 +845,10 @@ void AAlsCharacter::StartRagdollingImplementation()
 	});
 
 	RagdollingState.PullForce = 0.0f;
+	RagdollingState.RestTime = 0.0f;
+	RagdollingState.bAtRest = false;
+	RagdollingState.MotorsUpdateTimeRemaining = 0.0f;
+	RagdollingState.MotorsStiffness = -1.0f;
 
 	if (Settings->Ragdolling.bLimitInitialRagdollSpeed)
 	{
@@ -786,8 +870,13 @@ void AAlsCharacter::StartRagdollingImplementation()
 		SetRagdollTargetLocation(FVector::ZeroVector);
 	}
 
+	RagdollingState.TargetLocation = FVector::ZeroVector;
+	RagdollingState.TargetLocationSendTimeRemaining = Settings->Ragdolling.TargetLocationSendInterval;
+
 	if (IsLocallyControlled() || (GetLocalRole() >= ROLE_Authority && !IsValid(GetController())))
 	{
+		RagdollingState.TargetLocation = PelvisLocation;
+
 		SetRagdollTargetLocation(PelvisLocation);
 	}
 
@@ -834,6 +923,23 @@ void AAlsCharacter::RefreshRagdolling(const float DeltaTime)
 	// they may return an incorrect result in situations like when the animation blueprint is not ticking or when URO is enabled.
 
 	const auto* PelvisBody{GetMesh()->GetBodyInstance(UAlsConstants::PelvisBoneName())};
+
+	const auto TargetLocationToleranceSquared{FMath::Square(Settings->Ragdolling.TargetLocationSendDistanceThreshold)};
+
+	// Check all bodies, since a limb may still be moving while the pelvis body is already asleep.
+
+	const auto bAsleep{Settings->Ragdolling.bSuspendWhileAtRest && !GetMesh()->IsAnyRigidBodyAwake()};
+
+	if (bAsleep &&
+	    FVector::DistSquared(RagdollTargetLocation, RagdollingState.TargetLocation) <= TargetLocationToleranceSquared)
+	{
+		// Nothing moves while the ragdoll is asleep, so there is nothing to do until it wakes up or a new target
+		// location is received, in which case the logic below will be resumed to pull the ragdoll to that location.
+
+		RagdollingState.bAtRest = true;
+		return;
+	}
+
 	FVector PelvisLocation;
 
 	FPhysicsCommand::ExecuteRead(PelvisBody->ActorHandle, [this, &PelvisLocation](const FPhysicsActorHandle& ActorHandle)
@@ -842,25 +948,75 @@ void AAlsCharacter::RefreshRagdolling(const float DeltaTime)
 		RagdollingState.Velocity = FPhysicsInterface::GetLinearVelocity_AssumesLocked(ActorHandle);
 	});
 
+	if (Settings->Ragdolling.bSuspendWhileAtRest &&
+	    RagdollingState.Velocity.SizeSquared() <= FMath::Square(Settings->Ragdolling.RestSpeedThreshold))
+	{
+		RagdollingState.RestTime += DeltaTime;
+	}
+	else
+	{
+		RagdollingState.RestTime = 0.0f;
+	}
+
+	RagdollingState.bAtRest = Settings->Ragdolling.bSuspendWhileAtRest &&
+	                          (RagdollingState.RestTime >= Settings->Ragdolling.RestTimeThreshold || bAsleep);
+
 	const auto bLocallyControlled{IsLocallyControlled() || (GetLocalRole() >= ROLE_Authority && !IsValid(GetController()))};
 
 	if (bLocallyControlled)
 	{
-		SetRagdollTargetLocation(PelvisLocation);
+		RagdollingState.TargetLocation = PelvisLocation;
+
+		// Limit the send rate of the target location and skip small changes to reduce network traffic.
+
+		RagdollingState.TargetLocationSendTimeRemaining -= DeltaTime;
+
+		if (RagdollingState.TargetLocationSendTimeRemaining <= 0.0f &&
+		    FVector::DistSquared(PelvisLocation, RagdollTargetLocation) > TargetLocationToleranceSquared)
+		{
+			RagdollingState.TargetLocationSendTimeRemaining = Settings->Ragdolling.TargetLocationSendInterval;
+
+			SetRagdollTargetLocation(PelvisLocation);
+		}
+	}
+	else if (RagdollTargetLocation.IsZero())
+	{
+		RagdollingState.TargetLocation = FVector::ZeroVector;
+	}
+	else if (RagdollingState.TargetLocation.IsZero() || Settings->Ragdolling.TargetLocationInterpolationSpeed <= 0.0f)
+	{
+		RagdollingState.TargetLocation = RagdollTargetLocation;
 	}
+	else
+	{
+		// Smoothly interpolate towards the received target location to hide the reduced send rate.
+
+		RagdollingState.TargetLocation = FMath::VInterpTo(RagdollingState.TargetLocation, RagdollTargetLocation,
+		                                                  DeltaTime, Settings->Ragdolling.TargetLocationInterpolationSpeed);
+	}
+
+	// While the ragdoll is at rest and its target location has settled, the ground trace and location corrections can be skipped.
+
+	const auto bSettledAtRest{
+		RagdollingState.bAtRest &&
+		FVector::DistSquared(RagdollTargetLocation, RagdollingState.TargetLocation) <= TargetLocationToleranceSquared
+	};
 
 	// Prevent the capsule from going through the ground when the ragdoll is lying on the ground.
 
-	// While we could get rid of the line trace here and just use RagdollTargetLocation
+	// While we could get rid of the line trace here and just use the target location
 	// as the character's location, we don't do that because the camera depends on the
 	// capsule's bottom location, so its removal will cause the camera to behave erratically.
 
-	bool bGrounded;
-	SetActorLocation(RagdollTraceGround(bGrounded), false, nullptr, ETeleportType::TeleportPhysics);
+	if (!bSettledAtRest || FVector::DistSquared2D(GetActorLocation(), RagdollingState.TargetLocation) > TargetLocationToleranceSquared)
+	{
+		bool bGrounded;
+		SetActorLocation(RagdollTraceGround(bGrounded), false, nullptr, ETeleportType::TeleportPhysics);
+	}
 
 	// Zero target location means that it hasn't been replicated yet, so we can't apply the logic below.
 
-	if (!bLocallyControlled && !RagdollTargetLocation.IsZero())
+	if (!bLocallyControlled && !bSettledAtRest && !RagdollingState.TargetLocation.IsZero())
 	{
 		// Apply ragdoll location corrections.
 
@@ -885,7 +1041,7 @@ void AAlsCharacter::RefreshRagdolling(const float DeltaTime)
 			}
 
 			const auto PullForceVector{
-				RagdollTargetLocation - FPhysicsInterface::GetTransform_AssumesLocked(ActorHandle, true).GetLocation()
+				RagdollingState.TargetLocation - FPhysicsInterface::GetTransform_AssumesLocked(ActorHandle, true).GetLocation()
 			};
 
 			static constexpr auto MinPullForceDistance{5.0f};
@@ -899,14 +1055,55 @@ void AAlsCharacter::RefreshRagdolling(const float DeltaTime)
 		});
 	}
 
-	// Use the speed to scale ragdoll joint strength for physical animation.
+	// Use the speed to scale ragdoll joint strength for physical animation. The joint strength is
+	// almost zero while the ragdoll is at rest, so there is no need to update it in this case.
+
+	if (!RagdollingState.bAtRest)
+	{
+		RagdollingState.MotorsUpdateTimeRemaining -= DeltaTime;
+
+		if (RagdollingState.MotorsUpdateTimeRemaining <= 0.0f)
+		{
+			// Update motors less frequently for distant characters.
+
+			switch (LodLevel)
+			{
+				case EAlsLodLevel::Reduced:
+					RagdollingState.MotorsUpdateTimeRemaining = Settings->Ragdolling.ReducedLodMotorsUpdateInterval;
+					break;
+
+				case EAlsLodLevel::Minimal:
+					RagdollingState.MotorsUpdateTimeRemaining = Settings->Ragdolling.MinimalLodMotorsUpdateInterval;
+					break;
+
+				default:
+					RagdollingState.MotorsUpdateTimeRemaining = 0.0f;
+					break;
+			}
+
+			static constexpr auto ReferenceSpeed{1000.0f};
+			static constexpr auto Stiffness{25000.0f};
+
+			const auto SpeedAmount{UAlsMath::Clamp01(UE_REAL_TO_FLOAT(RagdollingState.Velocity.Size() / ReferenceSpeed))};
+			const auto NewMotorsStiffness{SpeedAmount * Stiffness};
 
-	static constexpr auto ReferenceSpeed{1000.0f};
-	static constexpr auto Stiffness{25000.0f};
+			// Pushing new drive parameters to every constraint is expensive, so do this only when the stiffness
+			// changes noticeably, but always apply zero stiffness so that the ragdoll can become fully limp.
 
-	const auto SpeedAmount{UAlsMath::Clamp01(UE_REAL_TO_FLOAT(RagdollingState.Velocity.Size() / ReferenceSpeed))};
+			if (RagdollingState.MotorsStiffness < 0.0f ||
+			    FMath::Abs(NewMotorsStiffness - RagdollingState.MotorsStiffness) > Settings->Ragdolling.MotorsStiffnessTolerance ||
+			    (NewMotorsStiffness <= 0.0f && RagdollingState.MotorsStiffness > 0.0f))
+			{
+				RagdollingState.MotorsStiffness = NewMotorsStiffness;
 
-	GetMesh()->SetAllMotorsAngularDriveParams(SpeedAmount * Stiffness, 0.0f, 0.0f);
+				GetMesh()->SetAllMotorsAngularDriveParams(NewMotorsStiffness, 0.0f, 0.0f);
+			}
+			else
+			{
+				INC_DWORD_STAT(STAT_AlsRagdollMotorsUpdatesSkipped);
+			}
+		}
+	}
 
 	// Limit the speed of ragdoll bodies.
 
@@ -914,13 +1111,16 @@ void AAlsCharacter::RefreshRagdolling(const float DeltaTime)
 	{
 		RagdollingState.SpeedLimitFrameTimeRemaining -= 1;
 
-		ConstraintRagdollSpeed();
+		if (!RagdollingState.bAtRest)
+		{
+			ConstraintRagdollSpeed();
+		}
 	}
 }
 
 FVector AAlsCharacter::RagdollTraceGround(bool& bGrounded) const
 {
-	auto RagdollLocation{!RagdollTargetLocation.IsZero() ? FVector{RagdollTargetLocation} : GetActorLocation()};
+	auto RagdollLocation{!RagdollingState.TargetLocation.IsZero() ? RagdollingState.TargetLocation : GetActorLocation()};
 
 	// We use a sphere sweep instead of a simple line trace to keep capsule
 	// movement consistent between ragdolling and regular character movement.
@@ -993,33 +1193,42 @@ bool AAlsCharacter::StopRagdolling()
 		return false;
 	}
 
+	// Send the final target location along with the reliable stop request, so that all sides stop ragdolling at the same
+	// location. It is quantized locally as well, so that the local side uses exactly the same value as the remote sides.
+
+	const auto bControllingSide{IsLocallyControlled() || (GetLocalRole() >= ROLE_Authority && !IsValid(GetController()))};
+
+	const FVector_NetQuantize FinalTargetLocation{
+		UAlsUtility::RoundTripNetQuantize(bControllingSide ? RagdollingState.TargetLocation : FVector{RagdollTargetLocation})
+	};
+
 	if (GetLocalRole() >= ROLE_Authority)
 	{
-		MulticastStopRagdolling();
+		MulticastStopRagdolling(FinalTargetLocation);
 	}
 	else
 	{
-		ServerStopRagdolling();
+		ServerStopRagdolling(FinalTargetLocation);
 	}
 
 	return true;
 }
 
-void AAlsCharacter::ServerStopRagdolling_Implementation()
+void AAlsCharacter::ServerStopRagdolling_Implementation(const FVector_NetQuantize& FinalTargetLocation)
 {
 	if (IsRagdollingAllowedToStop())
 	{
-		MulticastStopRagdolling();
+		MulticastStopRagdolling(FinalTargetLocation);
 		ForceNetUpdate();
 	}
 }
 
-void AAlsCharacter::MulticastStopRagdolling_Implementation()
+void AAlsCharacter::MulticastStopRagdolling_Implementation(const FVector_NetQuantize& FinalTargetLocation)
 {
-	StopRagdollingImplementation();
+	StopRagdollingImplementation(FinalTargetLocation);
 }
 
-void AAlsCharacter::StopRagdollingImplementation()
+void AAlsCharacter::StopRagdollingImplementation(const FVector& FinalTargetLocation)
 {
 	if (!IsRagdollingAllowedToStop())
 	{
@@ -1044,6 +1253,13 @@ void AAlsCharacter::StopRagdollingImplementation()
 	GetCharacterMovement()->NetworkSmoothingMode = ENetworkSmoothingMode::Exponential;
 	GetCharacterMovement()->bIgnoreClientMovementErrorChecksAndCorrection = false;
 
+	if (!FinalTargetLocation.IsZero())
+	{
+		// Skip the remaining interpolation so that all sides stop ragdolling at the same location.
+
+		RagdollingState.TargetLocation = FinalTargetLocation;
+	}
+
 	bool bGrounded;
 	const auto NewActorLocation{RagdollTraceGround(bGrounded)};
 
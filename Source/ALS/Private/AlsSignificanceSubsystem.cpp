@@ -0,0 +1,201 @@
+#include "AlsSignificanceSubsystem.h"
+
+#include "AlsCharacter.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Settings/AlsCharacterSettings.h"
+#include "Utility/AlsMacros.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsSignificanceSubsystem)
+
+bool UAlsSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UAlsSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAlsSignificanceSubsystem, STATGROUP_Tickables)
+}
+
+void UAlsSignificanceSubsystem::Tick(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsSignificanceSubsystem::Tick"), STAT_UAlsSignificanceSubsystem_Tick, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE(UAlsSignificanceSubsystem::Tick);
+
+	Super::Tick(DeltaTime);
+
+	// Significance changes slowly, so there is no need to refresh it every frame.
+
+	static constexpr auto RefreshInterval{0.25f};
+
+	RefreshTimeRemaining -= DeltaTime;
+	if (RefreshTimeRemaining > 0.0f)
+	{
+		return;
+	}
+
+	RefreshTimeRemaining = RefreshInterval;
+
+	Characters.RemoveAllSwap([](const TWeakObjectPtr<AAlsCharacter>& Character)
+	{
+		return !Character.IsValid();
+	});
+
+	RefreshViewLocations();
+
+	for (const auto& Character : Characters)
+	{
+		RefreshCharacterLodLevel(*Character);
+		RefreshCharacterNetworkLodLevel(*Character);
+	}
+}
+
+void UAlsSignificanceSubsystem::RegisterCharacter(AAlsCharacter* Character)
+{
+	if (ALS_ENSURE(IsValid(Character)))
+	{
+		Characters.AddUnique(Character);
+	}
+}
+
+void UAlsSignificanceSubsystem::UnregisterCharacter(AAlsCharacter* Character)
+{
+	Characters.RemoveSwap(Character);
+}
+
+EAlsLodLevel UAlsSignificanceSubsystem::CalculateLodLevel(const FAlsLodSettings& LodSettings, const float ViewDistanceSquared,
+                                                          const bool bLocallyControlled, const bool bRecentlyRendered)
+{
+	if (bLocallyControlled)
+	{
+		return EAlsLodLevel::Full;
+	}
+
+	auto LodLevel{EAlsLodLevel::Full};
+
+	if (ViewDistanceSquared > FMath::Square(LodSettings.MinimalLodDistance))
+	{
+		LodLevel = EAlsLodLevel::Minimal;
+	}
+	else if (ViewDistanceSquared > FMath::Square(LodSettings.ReducedLodDistance))
+	{
+		LodLevel = EAlsLodLevel::Reduced;
+	}
+
+	if (!bRecentlyRendered && LodSettings.bLowerLodWhenNotRendered && LodLevel < EAlsLodLevel::Minimal)
+	{
+		LodLevel = static_cast<EAlsLodLevel>(static_cast<uint8>(LodLevel) + 1);
+	}
+
+	return LodLevel;
+}
+
+EAlsLodLevel UAlsSignificanceSubsystem::CalculateNetworkLodLevel(const FAlsLodSettings& LodSettings, const float ViewDistanceSquared)
+{
+	if (ViewDistanceSquared > FMath::Square(LodSettings.MinimalNetworkLodDistance))
+	{
+		return EAlsLodLevel::Minimal;
+	}
+
+	if (ViewDistanceSquared > FMath::Square(LodSettings.ReducedNetworkLodDistance))
+	{
+		return EAlsLodLevel::Reduced;
+	}
+
+	return EAlsLodLevel::Full;
+}
+
+void UAlsSignificanceSubsystem::RefreshViewLocations()
+{
+	ViewLocations.Reset();
+	NetworkViewLocations.Reset();
+	NetworkViewPlayers.Reset();
+
+	const auto bServer{!GetWorld()->IsNetMode(NM_Client)};
+
+	for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		const auto* Player{Iterator->Get()};
+		if (!IsValid(Player) || (!bServer && !Player->IsLocalController()))
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		Player->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		if (Player->IsLocalController())
+		{
+			ViewLocations.Emplace(ViewLocation);
+		}
+
+		if (bServer)
+		{
+			NetworkViewLocations.Emplace(ViewLocation);
+			NetworkViewPlayers.Emplace(Player);
+		}
+	}
+}
+
+void UAlsSignificanceSubsystem::RefreshCharacterLodLevel(AAlsCharacter& Character) const
+{
+	const auto* Settings{Character.GetSettings()};
+
+	if (ViewLocations.IsEmpty() || !IsValid(Settings) || !Settings->Lod.bEnableLod)
+	{
+		// Without local viewers (for example, on a dedicated server) there is nothing to measure significance against.
+
+		Character.SetLodLevel(EAlsLodLevel::Full);
+		return;
+	}
+
+	const auto CharacterLocation{Character.GetActorLocation()};
+	auto ViewDistanceSquared{TNumericLimits<double>::Max()};
+
+	for (const auto& ViewLocation : ViewLocations)
+	{
+		ViewDistanceSquared = FMath::Min(ViewDistanceSquared, FVector::DistSquared(CharacterLocation, ViewLocation));
+	}
+
+	static constexpr auto RecentlyRenderedTolerance{0.5f};
+
+	Character.SetLodLevel(CalculateLodLevel(Settings->Lod, UE_REAL_TO_FLOAT(ViewDistanceSquared), Character.IsLocallyControlled(),
+	                                        Character.GetMesh()->WasRecentlyRendered(RecentlyRenderedTolerance)));
+}
+
+void UAlsSignificanceSubsystem::RefreshCharacterNetworkLodLevel(AAlsCharacter& Character) const
+{
+	if (!Character.HasAuthority())
+	{
+		// Clients receive the network LOD level from the server.
+		return;
+	}
+
+	const auto* Settings{Character.GetSettings()};
+
+	if (!IsValid(Settings) || !Settings->Lod.bEnableNetworkLod)
+	{
+		Character.SetNetworkLodLevel(EAlsLodLevel::Full);
+		return;
+	}
+
+	const auto CharacterLocation{Character.GetActorLocation()};
+	const auto* CharacterController{Character.GetController()};
+
+	auto ViewDistanceSquared{TNumericLimits<double>::Max()};
+
+	for (auto i{0}; i < NetworkViewLocations.Num(); i++)
+	{
+		// The character's own viewer doesn't receive its view rotation, so it shouldn't keep the character at full network LOD.
+
+		if (NetworkViewPlayers[i] != CharacterController)
+		{
+			ViewDistanceSquared = FMath::Min(ViewDistanceSquared, FVector::DistSquared(CharacterLocation, NetworkViewLocations[i]));
+		}
+	}
+
+	Character.SetNetworkLodLevel(CalculateNetworkLodLevel(Settings->Lod, UE_REAL_TO_FLOAT(ViewDistanceSquared)));
+}
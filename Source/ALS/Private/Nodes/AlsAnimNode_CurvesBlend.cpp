@@ -1,5 +1,6 @@
 #include "Nodes/AlsAnimNode_CurvesBlend.h"
 
+#include "Animation/AnimSequenceBase.h"
 #include "Animation/AnimTrace.h"
 #include "Utility/AlsEnumUtility.h"
 
@@ -36,7 +37,7 @@ void FAlsAnimNode_CurvesBlend::Update_AnyThread(const FAnimationUpdateContext& C
 	SourcePose.Update(Context);
 
 	const auto CurrentBlendAmount{GetBlendAmount()};
-	if (FAnimWeight::IsRelevant(CurrentBlendAmount))
+	if (FAnimWeight::IsRelevant(CurrentBlendAmount) && !IsValid(GetStaticCurvesSequence()))
 	{
 		CurvesPose.Update(Context);
 	}
@@ -60,56 +61,96 @@ void FAlsAnimNode_CurvesBlend::Evaluate_AnyThread(FPoseContext& Output)
 		return;
 	}
 
+	const auto* CurrentStaticCurvesSequence{GetStaticCurvesSequence()};
+	if (IsValid(CurrentStaticCurvesSequence))
+	{
+		BlendStaticCurves(Output.Curve, *CurrentStaticCurvesSequence, GetStaticCurvesSequenceTime(), CurrentBlendAmount, GetBlendMode());
+		return;
+	}
+
 	auto CurvesPoseContext{Output};
 	CurvesPose.Evaluate(CurvesPoseContext);
 
-	switch (GetBlendMode())
+	BlendCurves(Output.Curve, CurvesPoseContext.Curve, CurrentBlendAmount, GetBlendMode());
+}
+
+void FAlsAnimNode_CurvesBlend::GatherDebugData(FNodeDebugData& DebugData)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(GatherDebugData)
+
+	TStringBuilder<256> DebugItemBuilder{InPlace, DebugData.GetNodeName(this), TEXTVIEW(": Blend Amount: ")};
+
+	DebugItemBuilder.Appendf(TEXT("%.2f"), GetBlendAmount());
+
+	const auto* CurrentStaticCurvesSequence{GetStaticCurvesSequence()};
+	if (IsValid(CurrentStaticCurvesSequence))
+	{
+		DebugItemBuilder << TEXTVIEW(", Static Curves Sequence: ") << CurrentStaticCurvesSequence->GetName();
+	}
+
+	DebugData.AddDebugItem(FString{DebugItemBuilder});
+	SourcePose.GatherDebugData(DebugData.BranchFlow(1.0f));
+	CurvesPose.GatherDebugData(DebugData.BranchFlow(IsValid(CurrentStaticCurvesSequence) ? 0.0f : GetBlendAmount()));
+}
+
+float FAlsAnimNode_CurvesBlend::GetBlendAmount() const
+{
+	return GET_ANIM_NODE_DATA(float, BlendAmount);
+}
+
+EAlsCurvesBlendMode FAlsAnimNode_CurvesBlend::GetBlendMode() const
+{
+	return GET_ANIM_NODE_DATA(EAlsCurvesBlendMode, BlendMode);
+}
+
+UAnimSequenceBase* FAlsAnimNode_CurvesBlend::GetStaticCurvesSequence() const
+{
+	return GET_ANIM_NODE_DATA(TObjectPtr<UAnimSequenceBase>, StaticCurvesSequence);
+}
+
+float FAlsAnimNode_CurvesBlend::GetStaticCurvesSequenceTime() const
+{
+	return GET_ANIM_NODE_DATA(float, StaticCurvesSequenceTime);
+}
+
+void FAlsAnimNode_CurvesBlend::BlendCurves(FBlendedCurve& Curve, const FBlendedCurve& CurvesToBlend,
+                                           const float Amount, const EAlsCurvesBlendMode Mode)
+{
+	switch (Mode)
 	{
 		case EAlsCurvesBlendMode::BlendByAmount:
-			Output.Curve.Accumulate(CurvesPoseContext.Curve, CurrentBlendAmount);
+			Curve.Accumulate(CurvesToBlend, Amount);
 			break;
 
 		case EAlsCurvesBlendMode::Combine:
-			Output.Curve.Combine(CurvesPoseContext.Curve);
+			Curve.Combine(CurvesToBlend);
 			break;
 
 		case EAlsCurvesBlendMode::CombinePreserved:
-			Output.Curve.CombinePreserved(CurvesPoseContext.Curve);
+			Curve.CombinePreserved(CurvesToBlend);
 			break;
 
 		case EAlsCurvesBlendMode::UseMaxValue:
-			Output.Curve.UseMaxValue(CurvesPoseContext.Curve);
+			Curve.UseMaxValue(CurvesToBlend);
 			break;
 
 		case EAlsCurvesBlendMode::UseMinValue:
-			Output.Curve.UseMinValue(CurvesPoseContext.Curve);
+			Curve.UseMinValue(CurvesToBlend);
 			break;
 
 		case EAlsCurvesBlendMode::Override:
-			Output.Curve.Override(CurvesPoseContext.Curve);
+			Curve.Override(CurvesToBlend);
 			break;
 	}
 }
 
-void FAlsAnimNode_CurvesBlend::GatherDebugData(FNodeDebugData& DebugData)
+void FAlsAnimNode_CurvesBlend::BlendStaticCurves(FBlendedCurve& Curve, const UAnimSequenceBase& Sequence, const float SequenceTime,
+                                                 const float Amount, const EAlsCurvesBlendMode Mode)
 {
-	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(GatherDebugData)
+	FBlendedCurve SequenceCurves;
+	SequenceCurves.InitFrom(Curve);
 
-	TStringBuilder<256> DebugItemBuilder{InPlace, DebugData.GetNodeName(this), TEXTVIEW(": Blend Amount: ")};
+	Sequence.EvaluateCurveData(SequenceCurves, FAnimExtractContext{static_cast<double>(SequenceTime)});
 
-	DebugItemBuilder.Appendf(TEXT("%.2f"), GetBlendAmount());
-
-	DebugData.AddDebugItem(FString{DebugItemBuilder});
-	SourcePose.GatherDebugData(DebugData.BranchFlow(1.0f));
-	CurvesPose.GatherDebugData(DebugData.BranchFlow(GetBlendAmount()));
-}
-
-float FAlsAnimNode_CurvesBlend::GetBlendAmount() const
-{
-	return GET_ANIM_NODE_DATA(float, BlendAmount);
-}
-
-EAlsCurvesBlendMode FAlsAnimNode_CurvesBlend::GetBlendMode() const
-{
-	return GET_ANIM_NODE_DATA(EAlsCurvesBlendMode, BlendMode);
+	BlendCurves(Curve, SequenceCurves, Amount, Mode);
 }
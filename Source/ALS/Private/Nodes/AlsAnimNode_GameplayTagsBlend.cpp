@@ -2,13 +2,72 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimNode_GameplayTagsBlend)
 
+void FAlsAnimNode_GameplayTagsBlend::Initialize_AnyThread(const FAnimationInitializeContext& Context)
+{
+	RefreshChildIndices();
+
+	Super::Initialize_AnyThread(Context);
+}
+
 int32 FAlsAnimNode_GameplayTagsBlend::GetActiveChildIndex()
 {
 	const auto& CurrentActiveTag{GetActiveTag()};
+	if (!CurrentActiveTag.IsValid())
+	{
+		return 0;
+	}
+
+	// The active tag usually stays the same for many frames, so check the previous result first.
+
+	const auto& CurrentTags{GetTags()};
+
+	if (CurrentActiveTag == PreviousActiveTag && CurrentTags.IsValidIndex(PreviousActiveChildIndex - 1) &&
+	    CurrentTags[PreviousActiveChildIndex - 1] == CurrentActiveTag)
+	{
+		return PreviousActiveChildIndex;
+	}
+
+	const auto* ChildIndex{ChildIndices.Find(CurrentActiveTag)};
+
+	// The tags can change after initialization only if they are exposed as a pin. A hit is checked against the tags
+	// directly, while a miss is checked against the tags the map was built from, which costs no more than a linear search.
+
+	if (ChildIndex != nullptr
+		    ? !CurrentTags.IsValidIndex(*ChildIndex - 1) || CurrentTags[*ChildIndex - 1] != CurrentActiveTag
+		    : CurrentTags != ChildIndicesTags)
+	{
+		RefreshChildIndices();
+
+		ChildIndex = ChildIndices.Find(CurrentActiveTag);
+	}
+
+	PreviousActiveTag = CurrentActiveTag;
+	PreviousActiveChildIndex = ChildIndex != nullptr ? *ChildIndex : 0;
+
+	return PreviousActiveChildIndex;
+}
+
+void FAlsAnimNode_GameplayTagsBlend::RefreshChildIndices()
+{
+	const auto& CurrentTags{GetTags()};
+
+	ChildIndicesTags = CurrentTags;
+
+	ChildIndices.Reset();
+	ChildIndices.Reserve(CurrentTags.Num());
+
+	for (auto i{0}; i < CurrentTags.Num(); i++)
+	{
+		// Keep the first occurrence of duplicate tags to match the behavior of a linear search.
+
+		if (!ChildIndices.Contains(CurrentTags[i]))
+		{
+			ChildIndices.Add(CurrentTags[i], i + 1);
+		}
+	}
 
-	return CurrentActiveTag.IsValid()
-		       ? GetTags().Find(CurrentActiveTag) + 1
-		       : 0;
+	PreviousActiveTag = FGameplayTag::EmptyTag;
+	PreviousActiveChildIndex = 0;
 }
 
 const FGameplayTag& FAlsAnimNode_GameplayTagsBlend::GetActiveTag() const
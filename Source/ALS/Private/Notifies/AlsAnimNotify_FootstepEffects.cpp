@@ -7,6 +7,7 @@
 #include "Components/AudioComponent.h"
 #include "Components/DecalComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/AssetManager.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
@@ -19,6 +20,83 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimNotify_FootstepEffects)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Footstep Effect Asset Misses"), STAT_AlsFootstepEffectAssetMisses, STATGROUP_Als)
+
+namespace AlsFootstepEffects
+{
+	template <typename ObjectType>
+	ObjectType* GetLoadedAsset(const TSoftObjectPtr<ObjectType>& Asset)
+	{
+		auto* LoadedAsset{Asset.Get()};
+
+		if (!IsValid(LoadedAsset) && !Asset.IsNull())
+		{
+			INC_DWORD_STAT(STAT_AlsFootstepEffectAssetMisses);
+		}
+
+		return LoadedAsset;
+	}
+}
+
+void UAlsFootstepEffectsSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	// The settings may be loaded before the asset manager is created, for example when they are referenced by a startup map.
+
+	UAssetManager::CallOrRegister_OnAssetManagerCreated(FSimpleMulticastDelegate::FDelegate::CreateUObject(
+		this, &ThisClass::LoadEffectsAsync));
+}
+
+void UAlsFootstepEffectsSettings::BeginDestroy()
+{
+	if (EffectsLoadHandle.IsValid())
+	{
+		EffectsLoadHandle->ReleaseHandle();
+		EffectsLoadHandle.Reset();
+	}
+
+	Super::BeginDestroy();
+}
+
+void UAlsFootstepEffectsSettings::LoadEffectsAsync()
+{
+	// Footstep effects are never spawned on dedicated servers, so there is no need to load their assets there.
+
+	if (EffectsLoadHandle.IsValid() || HasAnyFlags(RF_ClassDefaultObject) || IsRunningDedicatedServer() || IsRunningCommandlet())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> AssetPaths;
+	AssetPaths.Reserve(Effects.Num() * 3);
+
+	for (const auto& Tuple : Effects)
+	{
+		const auto& EffectSettings{Tuple.Value};
+
+		if (!EffectSettings.Sound.Sound.IsNull())
+		{
+			AssetPaths.AddUnique(EffectSettings.Sound.Sound.ToSoftObjectPath());
+		}
+
+		if (!EffectSettings.Decal.DecalMaterial.IsNull())
+		{
+			AssetPaths.AddUnique(EffectSettings.Decal.DecalMaterial.ToSoftObjectPath());
+		}
+
+		if (!EffectSettings.ParticleSystem.ParticleSystem.IsNull())
+		{
+			AssetPaths.AddUnique(EffectSettings.ParticleSystem.ParticleSystem.ToSoftObjectPath());
+		}
+	}
+
+	if (!AssetPaths.IsEmpty())
+	{
+		EffectsLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetPaths));
+	}
+}
+
 #if WITH_EDITOR
 void FAlsFootstepDecalSettings::PostEditChangeProperty(const FPropertyChangedEvent& ChangedEvent)
 {
@@ -50,6 +128,16 @@ void UAlsFootstepEffectsSettings::PostEditChangeProperty(FPropertyChangedEvent&
 		{
 			Tuple.Value.PostEditChangeProperty(ChangedEvent);
 		}
+
+		// Release the previously loaded assets and load the new ones.
+
+		if (EffectsLoadHandle.IsValid())
+		{
+			EffectsLoadHandle->ReleaseHandle();
+			EffectsLoadHandle.Reset();
+		}
+
+		LoadEffectsAsync();
 	}
 
 	Super::PostEditChangeProperty(ChangedEvent);
@@ -152,6 +240,10 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 		}
 	}
 
+	// Start loading the effect assets if the settings asset was not loaded from disk, for example if it was created at runtime.
+
+	FootstepEffectsSettings->LoadEffectsAsync();
+
 	const auto FootstepLocation{FootstepHit.ImpactPoint};
 
 	const auto FootstepRotation{
@@ -195,7 +287,13 @@ void UAlsAnimNotify_FootstepEffects::SpawnSound(USkeletalMeshComponent* Mesh, co
 		VolumeMultiplier *= 1.0f - UAlsMath::Clamp01(Mesh->GetAnimInstance()->GetCurveValue(UAlsConstants::FootstepSoundBlockCurveName()));
 	}
 
-	if (!FAnimWeight::IsRelevant(VolumeMultiplier) || !IsValid(SoundSettings.Sound.LoadSynchronous()))
+	if (!FAnimWeight::IsRelevant(VolumeMultiplier))
+	{
+		return;
+	}
+
+	auto* Sound{AlsFootstepEffects::GetLoadedAsset(SoundSettings.Sound)};
+	if (!IsValid(Sound))
 	{
 		return;
 	}
@@ -208,12 +306,12 @@ void UAlsAnimNotify_FootstepEffects::SpawnSound(USkeletalMeshComponent* Mesh, co
 
 		if (World->WorldType == EWorldType::EditorPreview)
 		{
-			UGameplayStatics::PlaySoundAtLocation(World, SoundSettings.Sound.Get(), FootstepLocation,
+			UGameplayStatics::PlaySoundAtLocation(World, Sound, FootstepLocation,
 			                                      VolumeMultiplier, SoundPitchMultiplier);
 		}
 		else
 		{
-			Audio = UGameplayStatics::SpawnSoundAtLocation(World, SoundSettings.Sound.Get(), FootstepLocation,
+			Audio = UGameplayStatics::SpawnSoundAtLocation(World, Sound, FootstepLocation,
 			                                               FootstepRotation.Rotator(),
 			                                               VolumeMultiplier, SoundPitchMultiplier);
 		}
@@ -224,7 +322,7 @@ void UAlsAnimNotify_FootstepEffects::SpawnSound(USkeletalMeshComponent* Mesh, co
 			FootBone == EAlsFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName()
 		};
 
-		Audio = UGameplayStatics::SpawnSoundAttached(SoundSettings.Sound.Get(), Mesh, FootBoneName, FVector::ZeroVector,
+		Audio = UGameplayStatics::SpawnSoundAttached(Sound, Mesh, FootBoneName, FVector::ZeroVector,
 		                                             FRotator::ZeroRotator, EAttachLocation::SnapToTarget,
 		                                             true, VolumeMultiplier, SoundPitchMultiplier);
 	}
@@ -244,7 +342,8 @@ void UAlsAnimNotify_FootstepEffects::SpawnDecal(USkeletalMeshComponent* Mesh, co
 		return;
 	}
 
-	if (!IsValid(DecalSettings.DecalMaterial.LoadSynchronous()))
+	auto* DecalMaterial{AlsFootstepEffects::GetLoadedAsset(DecalSettings.DecalMaterial)};
+	if (!IsValid(DecalMaterial))
 	{
 		return;
 	}
@@ -267,13 +366,13 @@ void UAlsAnimNotify_FootstepEffects::SpawnDecal(USkeletalMeshComponent* Mesh, co
 
 	if (DecalSettings.SpawnMode == EAlsFootstepDecalSpawnMode::SpawnAtTraceHitLocation || !FootstepHit.Component.IsValid())
 	{
-		Decal = UGameplayStatics::SpawnDecalAtLocation(Mesh->GetWorld(), DecalSettings.DecalMaterial.Get(),
+		Decal = UGameplayStatics::SpawnDecalAtLocation(Mesh->GetWorld(), DecalMaterial,
 		                                               FVector{DecalSettings.Size} * MeshScale,
 		                                               DecalLocation, DecalRotation.Rotator());
 	}
 	else if (DecalSettings.SpawnMode == EAlsFootstepDecalSpawnMode::SpawnAttachedToTraceHitComponent)
 	{
-		Decal = UGameplayStatics::SpawnDecalAttached(DecalSettings.DecalMaterial.Get(),
+		Decal = UGameplayStatics::SpawnDecalAttached(DecalMaterial,
 		                                             FVector{DecalSettings.Size} * MeshScale,
 		                                             FootstepHit.Component.Get(), NAME_None, DecalLocation,
 		                                             DecalRotation.Rotator(), EAttachLocation::KeepWorldPosition);
@@ -289,7 +388,8 @@ void UAlsAnimNotify_FootstepEffects::SpawnParticleSystem(USkeletalMeshComponent*
                                                          const FAlsFootstepParticleSystemSettings& ParticleSystemSettings,
                                                          const FVector& FootstepLocation, const FQuat& FootstepRotation) const
 {
-	if (!IsValid(ParticleSystemSettings.ParticleSystem.LoadSynchronous()))
+	auto* ParticleSystem{AlsFootstepEffects::GetLoadedAsset(ParticleSystemSettings.ParticleSystem)};
+	if (!IsValid(ParticleSystem))
 	{
 		return;
 	}
@@ -311,7 +411,7 @@ void UAlsAnimNotify_FootstepEffects::SpawnParticleSystem(USkeletalMeshComponent*
 			ParticleSystemRotation.RotateVector(FVector{ParticleSystemSettings.LocationOffset} * MeshScale)
 		};
 
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(Mesh->GetWorld(), ParticleSystemSettings.ParticleSystem.Get(),
+		UNiagaraFunctionLibrary::SpawnSystemAtLocation(Mesh->GetWorld(), ParticleSystem,
 		                                               ParticleSystemLocation, ParticleSystemRotation.Rotator(),
 		                                               FVector::OneVector * MeshScale, true, true, ENCPoolMethod::AutoRelease);
 	}
@@ -319,7 +419,7 @@ void UAlsAnimNotify_FootstepEffects::SpawnParticleSystem(USkeletalMeshComponent*
 	{
 		const auto& FootBoneName{FootBone == EAlsFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName()};
 
-		UNiagaraFunctionLibrary::SpawnSystemAttached(ParticleSystemSettings.ParticleSystem.Get(), Mesh, FootBoneName,
+		UNiagaraFunctionLibrary::SpawnSystemAttached(ParticleSystem, Mesh, FootBoneName,
 		                                             FVector{ParticleSystemSettings.LocationOffset} * MeshScale,
 		                                             FRotator{
 			                                             FootBone == EAlsFootBone::Left
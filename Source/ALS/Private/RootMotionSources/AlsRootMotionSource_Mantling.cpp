@@ -7,7 +7,6 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Settings/AlsMantlingSettings.h"
 #include "Utility/AlsMacros.h"
-#include "Utility/AlsMontageUtility.h"
 #include "Utility/AlsRotation.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsRootMotionSource_Mantling)
@@ -77,7 +76,7 @@ void FAlsRootMotionSource_Mantling::PrepareRootMotion(const float SimulationDelt
 		                                                MontageBlendIn.GetBlendOption(), MontageBlendIn.GetCustomCurve());
 	}
 
-	const auto CurrentAnimationLocation{UAlsMontageUtility::ExtractRootTransformFromMontage(Montage, MontageTime).GetLocation()};
+	const auto CurrentAnimationLocation{MantlingSettings->GetRootMotionLocation(MontageTime)};
 
 	// The target animation location is expected to be non-zero, so it's safe to divide by it here.
 
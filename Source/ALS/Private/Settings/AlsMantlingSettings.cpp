@@ -1,7 +1,172 @@
 #include "Settings/AlsMantlingSettings.h"
 
+#include "Algo/BinarySearch.h"
+#include "Animation/AnimMontage.h"
+#include "Utility/AlsMath.h"
+#include "Utility/AlsMontageUtility.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsMantlingSettings)
 
+#if WITH_EDITOR
+void UAlsMantlingSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		// The montage or its animations may be edited or reimported while this asset is loaded, so listen
+		// for their changes to avoid mantling with stale root motion locations until the editor is restarted.
+
+		FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &ThisClass::OnObjectPropertyChanged);
+	}
+}
+
+void UAlsMantlingSettings::BeginDestroy()
+{
+	FCoreUObjectDelegates::OnObjectPropertyChanged.RemoveAll(this);
+
+	Super::BeginDestroy();
+}
+
+void UAlsMantlingSettings::PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent)
+{
+	if (ChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(ThisClass, Montage))
+	{
+		ResetRootMotionLocations();
+	}
+
+	Super::PostEditChangeProperty(ChangedEvent);
+}
+
+void UAlsMantlingSettings::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& ChangedEvent)
+{
+	if (RootMotionLocations.IsEmpty() || !IsValid(Montage))
+	{
+		return;
+	}
+
+	if (Object == Montage)
+	{
+		ResetRootMotionLocations();
+		return;
+	}
+
+	if (!Object->IsA<UAnimSequenceBase>())
+	{
+		return;
+	}
+
+	for (const auto& SlotAnimationTrack : Montage->SlotAnimTracks)
+	{
+		for (const auto& AnimationSegment : SlotAnimationTrack.AnimTrack.AnimSegments)
+		{
+			if (AnimationSegment.GetAnimReference() == Object)
+			{
+				ResetRootMotionLocations();
+				return;
+			}
+		}
+	}
+}
+#endif
+
+FVector UAlsMantlingSettings::GetRootMotionLocation(const float Time) const
+{
+	if (!RefreshRootMotionLocations())
+	{
+		return FVector::ZeroVector;
+	}
+
+	const auto LastIndex{RootMotionLocations.Num() - 1};
+	const auto ClampedTime{FMath::Clamp(Time, 0.0f, Montage->GetPlayLength())};
+
+	const auto Index{FMath::Min(FMath::FloorToInt32(ClampedTime / RootMotionSampleInterval), LastIndex - 1)};
+
+	// The last sample may be closer to the previous one than the sample interval, so the end time is clamped to the montage length.
+
+	const auto StartTime{static_cast<float>(Index) * RootMotionSampleInterval};
+	const auto EndTime{FMath::Min(StartTime + RootMotionSampleInterval, Montage->GetPlayLength())};
+
+	const auto Alpha{EndTime - StartTime > UE_SMALL_NUMBER ? UAlsMath::Clamp01((ClampedTime - StartTime) / (EndTime - StartTime)) : 1.0f};
+
+	return FMath::Lerp(RootMotionLocations[Index], RootMotionLocations[Index + 1], Alpha);
+}
+
+FVector UAlsMantlingSettings::GetLastRootMotionLocation() const
+{
+	return RefreshRootMotionLocations() ? RootMotionLocations.Last() : FVector::ZeroVector;
+}
+
+float UAlsMantlingSettings::FindRootMotionTimeByLocationZ(const float LocationZ) const
+{
+	if (!RefreshRootMotionLocations() || RootMotionLocations[0].Z >= LocationZ)
+	{
+		return 0.0f;
+	}
+
+	// The vertical root motion location is expected to increase over time, so a binary search can be
+	// used to find the first sample that reaches the specified location, and then interpolate to it.
+
+	const auto Index{
+		Algo::LowerBound(RootMotionLocations, LocationZ, [](const FVector& Location, const float Value)
+		{
+			return Location.Z < Value;
+		})
+	};
+
+	if (Index >= RootMotionLocations.Num())
+	{
+		return Montage->GetPlayLength();
+	}
+
+	const auto PreviousLocationZ{RootMotionLocations[Index - 1].Z};
+	const auto Alpha{UE_REAL_TO_FLOAT((LocationZ - PreviousLocationZ) / (RootMotionLocations[Index].Z - PreviousLocationZ))};
+
+	const auto StartTime{static_cast<float>(Index - 1) * RootMotionSampleInterval};
+	const auto EndTime{FMath::Min(StartTime + RootMotionSampleInterval, Montage->GetPlayLength())};
+
+	return FMath::Lerp(StartTime, EndTime, Alpha);
+}
+
+void UAlsMantlingSettings::ResetRootMotionLocations() const
+{
+	RootMotionLocations.Reset();
+	RootMotionMontage.Reset();
+}
+
+bool UAlsMantlingSettings::RefreshRootMotionLocations() const
+{
+	if (!IsValid(Montage))
+	{
+		return false;
+	}
+
+	if (RootMotionMontage == Montage && RootMotionLocations.Num() >= 2)
+	{
+		return true;
+	}
+
+	RootMotionMontage = Montage;
+	RootMotionSampleInterval = 1.0f / static_cast<float>(Montage->GetSamplingFrameRate().AsDecimal());
+
+	const auto PlayLength{Montage->GetPlayLength()};
+	const auto SamplesCount{FMath::Max(2, FMath::CeilToInt32(PlayLength / RootMotionSampleInterval) + 1)};
+
+	RootMotionLocations.Reset(SamplesCount);
+
+	for (auto i{0}; i < SamplesCount - 1; i++)
+	{
+		RootMotionLocations.Emplace(UAlsMontageUtility::ExtractRootTransformFromMontage(
+			Montage, FMath::Min(static_cast<float>(i) * RootMotionSampleInterval, PlayLength)).GetLocation());
+	}
+
+	// The last sample is extracted separately, since the montage segment may not be found exactly at the end of the montage.
+
+	RootMotionLocations.Emplace(UAlsMontageUtility::ExtractLastRootTransformFromMontage(Montage).GetLocation());
+
+	return true;
+}
+
 #if WITH_EDITOR
 void FAlsGeneralMantlingSettings::PostEditChangeProperty(const FPropertyChangedEvent& ChangedEvent)
 {
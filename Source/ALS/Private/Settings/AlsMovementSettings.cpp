@@ -0,0 +1,350 @@
+﻿#include "Settings/AlsMovementSettings.h"
+
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveVector.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsMovementSettings)
+
+namespace AlsMovementSettings
+{
+	static constexpr auto MaxGaitAmount{3.0f};
+
+	template <typename ValueType>
+	ValueType SampleBakedCurve(const ValueType (&Samples)[FAlsMovementBakedGaitCurves::SamplesCount], const float GaitAmount)
+	{
+		const auto SamplePosition{FMath::Clamp(GaitAmount / MaxGaitAmount, 0.0f, 1.0f) * (FAlsMovementBakedGaitCurves::SamplesCount - 1)};
+		const auto SampleIndex{FMath::Min(FMath::FloorToInt32(SamplePosition), FAlsMovementBakedGaitCurves::SamplesCount - 2)};
+
+		return FMath::Lerp(Samples[SampleIndex], Samples[SampleIndex + 1], SamplePosition - SampleIndex);
+	}
+
+	void NetSerializeTag(FArchive& Archive, UPackageMap* Map, FGameplayTag& Tag,
+	                     const TConstArrayView<FGameplayTag> KnownTags, const int32 IndexBits)
+	{
+		// Known tags are sent as a few bits wide index. The largest index that fits
+		// into the bit width marks a custom tag, which is sent in full after it.
+
+		const uint32 CustomTagIndex{(1u << IndexBits) - 1};
+
+		auto Index{CustomTagIndex};
+
+		if (Archive.IsSaving())
+		{
+			const auto KnownIndex{KnownTags.IndexOfByKey(Tag)};
+			if (KnownIndex != INDEX_NONE)
+			{
+				Index = static_cast<uint32>(KnownIndex);
+			}
+		}
+
+		Archive.SerializeInt(Index, CustomTagIndex + 1);
+
+		if (Index == CustomTagIndex)
+		{
+			auto bSuccess{true};
+			Tag.NetSerialize(Archive, Map, bSuccess);
+
+			if (!bSuccess)
+			{
+				Archive.SetError();
+			}
+		}
+		else if (Archive.IsLoading())
+		{
+			if (KnownTags.IsValidIndex(static_cast<int32>(Index)))
+			{
+				Tag = KnownTags[static_cast<int32>(Index)];
+			}
+			else
+			{
+				Tag = FGameplayTag::EmptyTag;
+				Archive.SetError();
+			}
+		}
+	}
+}
+
+void AlsMovementSettingsIndices::NetSerializeRotationMode(FArchive& Archive, UPackageMap* Map, FGameplayTag& RotationMode)
+{
+	AlsMovementSettings::NetSerializeTag(Archive, Map, RotationMode, GetRotationModes(), RotationModeIndexBits);
+}
+
+void AlsMovementSettingsIndices::NetSerializeStance(FArchive& Archive, UPackageMap* Map, FGameplayTag& Stance)
+{
+	AlsMovementSettings::NetSerializeTag(Archive, Map, Stance, GetStances(), StanceIndexBits);
+}
+
+void AlsMovementSettingsIndices::NetSerializeGait(FArchive& Archive, UPackageMap* Map, FGameplayTag& Gait)
+{
+	AlsMovementSettings::NetSerializeTag(Archive, Map, Gait, GetGaits(), GaitIndexBits);
+}
+
+void FAlsMovementBakedGaitCurves::Bake(const FAlsMovementGaitSettings& GaitSettings)
+{
+	bAccelerationAndDecelerationAndGroundFrictionBaked = IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve);
+	bRotationInterpolationSpeedBaked = IsValid(GaitSettings.RotationInterpolationSpeedCurve);
+
+	for (auto i{0}; i < SamplesCount; i++)
+	{
+		const auto GaitAmount{AlsMovementSettings::MaxGaitAmount * i / (SamplesCount - 1)};
+
+		if (bAccelerationAndDecelerationAndGroundFrictionBaked)
+		{
+			AccelerationAndDecelerationAndGroundFriction[i] =
+				FVector3f{GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->GetVectorValue(GaitAmount)};
+		}
+
+		if (bRotationInterpolationSpeedBaked)
+		{
+			RotationInterpolationSpeed[i] = GaitSettings.RotationInterpolationSpeedCurve->GetFloatValue(GaitAmount);
+		}
+	}
+}
+
+float FAlsMovementBakedGaitCurves::CalculateMaxError(const FAlsMovementGaitSettings& GaitSettings) const
+{
+	// Compare the lookup tables with the curves between the samples, where the error is the largest.
+
+	static constexpr auto ErrorSamplesPerSegment{8};
+
+	auto MaxError{0.0f};
+
+	for (auto i{0}; i <= (SamplesCount - 1) * ErrorSamplesPerSegment; i++)
+	{
+		const auto GaitAmount{AlsMovementSettings::MaxGaitAmount * i / ((SamplesCount - 1) * ErrorSamplesPerSegment)};
+
+		if (bAccelerationAndDecelerationAndGroundFrictionBaked &&
+		    IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve))
+		{
+			const auto Error{
+				FVector3f{GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->GetVectorValue(GaitAmount)} -
+				SampleAccelerationAndDecelerationAndGroundFriction(GaitAmount)
+			};
+
+			MaxError = FMath::Max(MaxError, Error.GetAbsMax());
+		}
+
+		if (bRotationInterpolationSpeedBaked && IsValid(GaitSettings.RotationInterpolationSpeedCurve))
+		{
+			const auto Error{
+				GaitSettings.RotationInterpolationSpeedCurve->GetFloatValue(GaitAmount) -
+				SampleRotationInterpolationSpeed(GaitAmount)
+			};
+
+			MaxError = FMath::Max(MaxError, FMath::Abs(Error));
+		}
+	}
+
+	return MaxError;
+}
+
+FVector3f FAlsMovementBakedGaitCurves::SampleAccelerationAndDecelerationAndGroundFriction(const float GaitAmount) const
+{
+	return AlsMovementSettings::SampleBakedCurve(AccelerationAndDecelerationAndGroundFriction, GaitAmount);
+}
+
+float FAlsMovementBakedGaitCurves::SampleRotationInterpolationSpeed(const float GaitAmount) const
+{
+	return AlsMovementSettings::SampleBakedCurve(RotationInterpolationSpeed, GaitAmount);
+}
+
+float FAlsMovementGaitSettings::GetAccelerationByGaitAmount(const float GaitAmount, const FAlsMovementBakedGaitCurves* BakedCurves) const
+{
+	return BakedCurves != nullptr && BakedCurves->bAccelerationAndDecelerationAndGroundFrictionBaked
+		       ? BakedCurves->SampleAccelerationAndDecelerationAndGroundFriction(GaitAmount).X
+		       : AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[0].Eval(GaitAmount);
+}
+
+float FAlsMovementGaitSettings::GetDecelerationByGaitAmount(const float GaitAmount, const FAlsMovementBakedGaitCurves* BakedCurves) const
+{
+	return BakedCurves != nullptr && BakedCurves->bAccelerationAndDecelerationAndGroundFrictionBaked
+		       ? BakedCurves->SampleAccelerationAndDecelerationAndGroundFriction(GaitAmount).Y
+		       : AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[1].Eval(GaitAmount);
+}
+
+float FAlsMovementGaitSettings::GetGroundFrictionByGaitAmount(const float GaitAmount, const FAlsMovementBakedGaitCurves* BakedCurves) const
+{
+	return BakedCurves != nullptr && BakedCurves->bAccelerationAndDecelerationAndGroundFrictionBaked
+		       ? BakedCurves->SampleAccelerationAndDecelerationAndGroundFriction(GaitAmount).Z
+		       : AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[2].Eval(GaitAmount);
+}
+
+float FAlsMovementGaitSettings::GetRotationInterpolationSpeedByGaitAmount(const float GaitAmount,
+                                                                         const FAlsMovementBakedGaitCurves* BakedCurves) const
+{
+	return BakedCurves != nullptr && BakedCurves->bRotationInterpolationSpeedBaked
+		       ? BakedCurves->SampleRotationInterpolationSpeed(GaitAmount)
+		       : RotationInterpolationSpeedCurve->GetFloatValue(GaitAmount);
+}
+
+void UAlsMovementSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	RefreshGaitSettingsTable();
+}
+
+#if WITH_EDITOR
+void UAlsMovementSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		// The curves may be edited or reimported while this asset is loaded, so listen for their changes to rebake them.
+
+		FCoreUObjectDelegates::OnObjectModified.AddUObject(this, &ThisClass::OnObjectModified);
+		FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &ThisClass::OnObjectPropertyChanged);
+	}
+}
+
+void UAlsMovementSettings::BeginDestroy()
+{
+	FCoreUObjectDelegates::OnObjectModified.RemoveAll(this);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.RemoveAll(this);
+
+	Super::BeginDestroy();
+}
+
+void UAlsMovementSettings::PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent)
+{
+	if (ChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(ThisClass, RotationModes))
+	{
+		RefreshGaitSettingsTable();
+	}
+
+	Super::PostEditChangeProperty(ChangedEvent);
+}
+
+void UAlsMovementSettings::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	// Undo and redo restore the rotation modes map without a property change notification.
+
+	RefreshGaitSettingsTable();
+}
+
+bool UAlsMovementSettings::IsCurveUsed(const UObject* Curve) const
+{
+	for (const auto& [RotationModeTag, StanceSettings] : RotationModes)
+	{
+		for (const auto& [StanceTag, GaitSettings] : StanceSettings.Stances)
+		{
+			if (GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve == Curve ||
+			    GaitSettings.RotationInterpolationSpeedCurve == Curve)
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void UAlsMovementSettings::OnObjectModified(UObject* Object)
+{
+	// The curve editor modifies curves without a property change notification, so the table is
+	// reset here and lazily rebuilt from the modified curves the next time it is accessed.
+
+	if (!GaitSettingsTable.IsEmpty() && Object->IsA<UCurveBase>() && IsCurveUsed(Object))
+	{
+		GaitSettingsTable.Reset();
+		BakedGaitCurves.Reset();
+	}
+}
+
+void UAlsMovementSettings::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& ChangedEvent)
+{
+	if (Object->IsA<UCurveBase>() && IsCurveUsed(Object))
+	{
+		RefreshGaitSettingsTable();
+	}
+}
+#endif
+
+void UAlsMovementSettings::RefreshGaitSettingsTable()
+{
+#if WITH_EDITOR
+	for (auto& [RotationModeTag, StanceSettings] : RotationModes)
+	{
+		for (auto& [StanceTag, GaitSettings] : StanceSettings.Stances)
+		{
+			GaitSettings.BakedCurvesMaxError = 0.0f;
+
+			if (GaitSettings.bUseBakedCurves)
+			{
+				FAlsMovementBakedGaitCurves BakedCurves;
+				BakedCurves.Bake(GaitSettings);
+
+				GaitSettings.BakedCurvesMaxError = BakedCurves.CalculateMaxError(GaitSettings);
+			}
+		}
+	}
+#endif
+
+	BuildGaitSettingsTable();
+}
+
+void UAlsMovementSettings::BuildGaitSettingsTable() const
+{
+	const auto RotationModeTags{AlsMovementSettingsIndices::GetRotationModes()};
+	const auto StanceTags{AlsMovementSettingsIndices::GetStances()};
+
+	GaitSettingsTable.Reset();
+	BakedGaitCurves.Reset();
+
+	GaitSettingsTable.SetNum(AlsMovementSettingsIndices::RotationModesCount * AlsMovementSettingsIndices::StancesCount);
+	BakedGaitCurves.SetNum(GaitSettingsTable.Num());
+
+	for (auto i{0}; i < AlsMovementSettingsIndices::RotationModesCount; i++)
+	{
+		const auto* StanceSettings{RotationModes.Find(RotationModeTags[i])};
+		if (StanceSettings == nullptr)
+		{
+			continue;
+		}
+
+		for (auto j{0}; j < AlsMovementSettingsIndices::StancesCount; j++)
+		{
+			const auto* GaitSettings{StanceSettings->Stances.Find(StanceTags[j])};
+			if (GaitSettings == nullptr)
+			{
+				continue;
+			}
+
+			const auto TableIndex{i * AlsMovementSettingsIndices::StancesCount + j};
+
+			auto& TableGaitSettings{GaitSettingsTable[TableIndex].Emplace(*GaitSettings)};
+			TableGaitSettings.TableIndex = TableIndex;
+
+			if (TableGaitSettings.bUseBakedCurves)
+			{
+				BakedGaitCurves[TableIndex].Emplace().Bake(TableGaitSettings);
+			}
+		}
+	}
+}
+
+const FAlsMovementGaitSettings* UAlsMovementSettings::FindGaitSettings(const FGameplayTag& RotationMode,
+                                                                       const FGameplayTag& Stance) const
+{
+	const auto RotationModeIndex{AlsMovementSettingsIndices::GetRotationModeIndex(RotationMode)};
+	const auto StanceIndex{AlsMovementSettingsIndices::GetStanceIndex(Stance)};
+
+	if (RotationModeIndex >= 0 && StanceIndex >= 0)
+	{
+		if (GaitSettingsTable.IsEmpty())
+		{
+			BuildGaitSettingsTable();
+		}
+
+		return GaitSettingsTable[RotationModeIndex * AlsMovementSettingsIndices::StancesCount + StanceIndex].GetPtrOrNull();
+	}
+
+	// Custom rotation modes and stances fall back to the regular lookup.
+
+	const auto* StanceSettings{RotationModes.Find(RotationMode)};
+
+	return StanceSettings != nullptr ? StanceSettings->Stances.Find(Stance) : nullptr;
+}
@@ -0,0 +1,24 @@
+#include "Settings/AlsRollingSettings.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsRollingSettings)
+
+bool FAlsRollingParameters::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	auto QuantizedPlayRate{QuantizePlayRate(PlayRate)};
+	auto QuantizedInitialYawAngle{QuantizeYawAngle(InitialYawAngle)};
+	auto QuantizedTargetYawAngle{QuantizeYawAngle(TargetYawAngle)};
+
+	Archive << QuantizedPlayRate;
+	Archive << QuantizedInitialYawAngle;
+	Archive << QuantizedTargetYawAngle;
+
+	if (Archive.IsLoading())
+	{
+		PlayRate = DequantizePlayRate(QuantizedPlayRate);
+		InitialYawAngle = DequantizeYawAngle(QuantizedInitialYawAngle);
+		TargetYawAngle = DequantizeYawAngle(QuantizedTargetYawAngle);
+	}
+
+	bSuccess = !Archive.IsError();
+	return true;
+}
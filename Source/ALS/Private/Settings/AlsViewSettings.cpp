@@ -0,0 +1,37 @@
+#include "Settings/AlsViewSettings.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsViewSettings)
+
+bool FAlsReplicatedViewRotation::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	uint32 NewAxisBitsCount{AxisBitsCount};
+	Archive.SerializeInt(NewAxisBitsCount, MaxAxisBitsCount + 1);
+
+	if (Archive.IsLoading())
+	{
+		AxisBitsCount = static_cast<uint8>(NewAxisBitsCount);
+	}
+
+	if (AxisBitsCount == 0)
+	{
+		Rotation.NetSerialize(Archive, Map, bSuccess);
+	}
+	else
+	{
+		auto QuantizedPitch{Archive.IsLoading() ? 0u : QuantizeAxis(Rotation.Pitch, AxisBitsCount)};
+		auto QuantizedYaw{Archive.IsLoading() ? 0u : QuantizeAxis(Rotation.Yaw, AxisBitsCount)};
+
+		Archive.SerializeBits(&QuantizedPitch, AxisBitsCount);
+		Archive.SerializeBits(&QuantizedYaw, AxisBitsCount);
+
+		if (Archive.IsLoading())
+		{
+			Rotation.Pitch = DequantizeAxis(QuantizedPitch, AxisBitsCount);
+			Rotation.Yaw = DequantizeAxis(QuantizedYaw, AxisBitsCount);
+			Rotation.Roll = 0.0f;
+		}
+	}
+
+	bSuccess = !Archive.IsError();
+	return true;
+}
@@ -0,0 +1,84 @@
+#include "AlsAnimationInstance.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsAnimationInstanceGroundPredictionTest, "Als.AnimationInstance.GroundPredictionExtrapolation",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsAnimationInstanceGroundPredictionTest::RunTest(const FString& Parameters)
+{
+	// Simulates falls onto flat ground with the default decimation settings, and compares the extrapolated
+	// time to impact with the time to impact that an actual sweep against the ground would return.
+
+	static constexpr auto Gravity{-980.0f};
+	static constexpr auto DeltaTime{1.0f / 60.0f};
+	static constexpr auto SweepInterval{0.1f};
+	static constexpr auto SweepMaxAngle{10.0f};
+	static constexpr auto CapsuleRadius{35.0f};
+	static constexpr auto CapsuleHalfHeight{90.0f};
+	static constexpr auto MaxSweepTimeError{0.03f};
+
+	const auto SweepMaxAngleCos{FMath::Cos(FMath::DegreesToRadians(SweepMaxAngle))};
+
+	auto ExtrapolationsCount{0};
+
+	for (const auto HorizontalSpeed : {0.0f, 200.0f, 400.0f, 650.0f, 900.0f})
+	{
+		for (const auto InitialVerticalSpeed : {-200.0f, -400.0f, -800.0f, -1500.0f})
+		{
+			FVector Location{0.0f, 0.0f, 1500.0f};
+			FVector Velocity{HorizontalSpeed, 0.0f, InitialVerticalSpeed};
+
+			auto bSweepValid{false};
+			auto SweepTime{0.0f};
+			FVector SweepDirection{ForceInit};
+			FVector ImpactLocation{ForceInit};
+
+			for (auto Time{0.0f}; Location.Z > CapsuleHalfHeight + 1.0f; Time += DeltaTime)
+			{
+				// Same sweep direction and distance as in UAlsAnimationInstance::RefreshGroundPrediction().
+
+				auto Direction{Velocity};
+				Direction.Z = FMath::Clamp(Direction.Z, -4000.0f, -200.0f);
+				Direction.Normalize();
+
+				const auto SweepDistance{
+					FMath::GetMappedRangeValueClamped(FVector2f{-200.0f, -4000.0f}, {150.0f, 2000.0f}, UE_REAL_TO_FLOAT(Velocity.Z))
+				};
+
+				const auto ExpectedSweepTime{UE_REAL_TO_FLOAT((CapsuleHalfHeight - Location.Z) / (SweepDistance * Direction.Z))};
+
+				if (!bSweepValid || Time - SweepTime >= SweepInterval || (Direction | SweepDirection) < SweepMaxAngleCos)
+				{
+					bSweepValid = ExpectedSweepTime <= 1.0f;
+					SweepTime = Time;
+					SweepDirection = Direction;
+					ImpactLocation = Location + Direction * (SweepDistance * ExpectedSweepTime);
+				}
+				else
+				{
+					float ExtrapolatedSweepTime;
+					if (ExpectedSweepTime <= 1.0f &&
+					    UAlsAnimationInstance::TryExtrapolateGroundPredictionSweepTime(Location, Direction, SweepDistance, CapsuleRadius,
+					                                                                   ImpactLocation, ExtrapolatedSweepTime))
+					{
+						TestEqual(FString::Printf(TEXT("Sweep time at %.2f s (%.0f, %.0f)"), Time, HorizontalSpeed, InitialVerticalSpeed),
+						          ExtrapolatedSweepTime, ExpectedSweepTime, MaxSweepTimeError);
+
+						ExtrapolationsCount += 1;
+					}
+				}
+
+				Velocity.Z += Gravity * DeltaTime;
+				Location += Velocity * DeltaTime;
+			}
+		}
+	}
+
+	TestTrue(TEXT("Extrapolation used"), ExtrapolationsCount > 0);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,142 @@
+#include "Animation/AnimSequence.h"
+#include "Animation/AnimData/IAnimationDataController.h"
+#include "Misc/AutomationTest.h"
+#include "Nodes/AlsAnimNode_CurvesBlend.h"
+#include "Utility/AlsEnumUtility.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+namespace AlsCurvesBlendTests
+{
+	TMap<FName, float> ToMap(const FBlendedCurve& Curve)
+	{
+		TMap<FName, float> Values;
+
+		Curve.ForEachElement([&Values](const UE::Anim::FCurveElement& Element)
+		{
+			Values.Add(Element.Name, Element.Value);
+		});
+
+		return Values;
+	}
+
+	float BlendValue(const EAlsCurvesBlendMode Mode, const float* Value, const float* ValueToBlend, const float Amount)
+	{
+		if (Value == nullptr)
+		{
+			return Mode == EAlsCurvesBlendMode::BlendByAmount ? *ValueToBlend * Amount : *ValueToBlend;
+		}
+
+		if (ValueToBlend == nullptr)
+		{
+			return *Value;
+		}
+
+		switch (Mode)
+		{
+			case EAlsCurvesBlendMode::BlendByAmount:
+				return *Value + *ValueToBlend * Amount;
+
+			case EAlsCurvesBlendMode::CombinePreserved:
+				return *Value;
+
+			case EAlsCurvesBlendMode::UseMaxValue:
+				return FMath::Max(*Value, *ValueToBlend);
+
+			case EAlsCurvesBlendMode::UseMinValue:
+				return FMath::Min(*Value, *ValueToBlend);
+
+			default:
+				return *ValueToBlend;
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsCurvesBlendStaticSequenceTest, "Als.CurvesBlend.StaticSequence",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsCurvesBlendStaticSequenceTest::RunTest(const FString& Parameters)
+{
+	static constexpr auto SequenceTime{0.5f};
+	static constexpr auto BlendAmount{0.5f};
+
+	static const FName SharedCurveName{TEXTVIEW("SharedCurve")};
+	static const FName SourceCurveName{TEXTVIEW("SourceCurve")};
+	static const FName SequenceCurveName{TEXTVIEW("SequenceCurve")};
+
+	auto* Skeleton{LoadObject<USkeleton>(nullptr, TEXT("/ALS/ALS/Character/SK_Als.SK_Als"))};
+	if (!TestNotNull(TEXT("Skeleton"), Skeleton))
+	{
+		return false;
+	}
+
+	auto* Sequence{NewObject<UAnimSequence>(GetTransientPackage())};
+	Sequence->SetSkeleton(Skeleton);
+
+	auto& Controller{Sequence->GetController()};
+	Controller.InitializeModel();
+	Controller.SetFrameRate(FFrameRate{30, 1}, false);
+	Controller.SetNumberOfFrames(FFrameNumber{30}, false);
+
+	const FAnimationCurveIdentifier SharedCurveIdentifier{SharedCurveName, ERawCurveTrackTypes::RCT_Float};
+	Controller.AddCurve(SharedCurveIdentifier, AACF_DefaultCurve, false);
+	Controller.SetCurveKeys(SharedCurveIdentifier, {FRichCurveKey{0.0f, 2.0f}, FRichCurveKey{1.0f, 6.0f}}, false);
+
+	const FAnimationCurveIdentifier SequenceCurveIdentifier{SequenceCurveName, ERawCurveTrackTypes::RCT_Float};
+	Controller.AddCurve(SequenceCurveIdentifier, AACF_DefaultCurve, false);
+	Controller.SetCurveKeys(SequenceCurveIdentifier, {FRichCurveKey{0.0f, 1.0f}, FRichCurveKey{1.0f, 3.0f}}, false);
+
+	Controller.NotifyPopulated();
+
+	FBlendedCurve SequenceCurves;
+	Sequence->EvaluateCurveData(SequenceCurves, FAnimExtractContext{static_cast<double>(SequenceTime)});
+
+	const auto SequenceValues{AlsCurvesBlendTests::ToMap(SequenceCurves)};
+
+	TestEqual(TEXT("Sampled shared curve"), SequenceValues.FindRef(SharedCurveName), 4.0f, UE_KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Sampled sequence curve"), SequenceValues.FindRef(SequenceCurveName), 2.0f, UE_KINDA_SMALL_NUMBER);
+
+	for (const auto Mode : {
+		     EAlsCurvesBlendMode::BlendByAmount, EAlsCurvesBlendMode::Combine, EAlsCurvesBlendMode::CombinePreserved,
+		     EAlsCurvesBlendMode::UseMaxValue, EAlsCurvesBlendMode::UseMinValue, EAlsCurvesBlendMode::Override
+	     })
+	{
+		const auto ModeName{AlsEnumUtility::GetNameStringByValue(Mode)};
+
+		FBlendedCurve Curve;
+		Curve.Set(SharedCurveName, 5.0f);
+		Curve.Set(SourceCurveName, 7.0f);
+
+		const auto SourceValues{AlsCurvesBlendTests::ToMap(Curve)};
+
+		FAlsAnimNode_CurvesBlend::BlendStaticCurves(Curve, *Sequence, SequenceTime, BlendAmount, Mode);
+
+		const auto Values{AlsCurvesBlendTests::ToMap(Curve)};
+
+		// The override mode discards the source curves, while all other modes keep the union of both curve sets.
+
+		auto ExpectedNames{SequenceValues};
+		if (Mode != EAlsCurvesBlendMode::Override)
+		{
+			ExpectedNames.Append(SourceValues);
+		}
+
+		TestEqual(FString::Printf(TEXT("%s: curves count"), *ModeName), Values.Num(), ExpectedNames.Num());
+
+		for (const auto& [CurveName, _] : ExpectedNames)
+		{
+			const auto ExpectedValue{
+				Mode == EAlsCurvesBlendMode::Override
+					? SequenceValues[CurveName]
+					: AlsCurvesBlendTests::BlendValue(Mode, SourceValues.Find(CurveName), SequenceValues.Find(CurveName), BlendAmount)
+			};
+
+			TestEqual(FString::Printf(TEXT("%s: %s"), *ModeName, *CurveName.ToString()),
+			          Values.FindRef(CurveName), ExpectedValue, UE_KINDA_SMALL_NUMBER);
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,64 @@
+#include "Misc/AutomationTest.h"
+#include "Utility/AlsCurvesCache.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsCurvesCacheGetCurveValueTest, "Als.CurvesCache.GetCurveValue",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsCurvesCacheGetCurveValueTest::RunTest(const FString& Parameters)
+{
+	const FName CurveNames[]{TEXT("Curve0"), TEXT("Curve1"), TEXT("Curve2"), TEXT("MissingCurve")};
+
+	FAlsCurvesCache CurvesCache;
+	CurvesCache.Initialize(CurveNames, nullptr);
+
+	const auto TestCurves{
+		[&](const TCHAR* What, const TMap<FName, float>& Curves)
+		{
+			// Read the curves twice, so that both the regular lookup and the cached curve locations are tested.
+
+			for (auto Pass{0}; Pass < 2; Pass++)
+			{
+				for (auto i{0}; i < static_cast<int32>(UE_ARRAY_COUNT(CurveNames)); i++)
+				{
+					TestEqual(FString::Printf(TEXT("%s: %s, pass %d"), What, *CurveNames[i].ToString(), Pass),
+					          CurvesCache.GetCurveValue(Curves, i), Curves.FindRef(CurveNames[i]));
+				}
+			}
+		}
+	};
+
+	TMap<FName, float> Curves;
+	Curves.Add(TEXT("Curve0"), 0.1f);
+	Curves.Add(TEXT("Curve1"), 0.2f);
+	Curves.Add(TEXT("Curve2"), 0.3f);
+
+	TestCurves(TEXT("Initial"), Curves);
+
+	// Rebuild the curves map in the same order with different values, as the animation update usually does.
+
+	Curves.Reset();
+	Curves.Add(TEXT("Curve0"), 0.4f);
+	Curves.Add(TEXT("Curve1"), 0.5f);
+	Curves.Add(TEXT("Curve2"), 0.6f);
+
+	TestCurves(TEXT("Same order"), Curves);
+
+	// Rebuild the curves map in a different order and with a curve missing, so that the cached locations become stale.
+
+	Curves.Reset();
+	Curves.Add(TEXT("UnrelatedCurve"), 1.0f);
+	Curves.Add(TEXT("Curve2"), 0.7f);
+	Curves.Add(TEXT("Curve0"), 0.8f);
+
+	TestCurves(TEXT("Different order"), Curves);
+
+	Curves.Reset();
+
+	TestCurves(TEXT("Empty"), Curves);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,115 @@
+#include "Misc/AutomationTest.h"
+#include "Nodes/AlsAnimNode_GameplayTagsBlend.h"
+#include "Utility/AlsGameplayTags.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITORONLY_DATA
+
+namespace AlsGameplayTagsBlendTests
+{
+	struct FTestNode : public FAlsAnimNode_GameplayTagsBlend
+	{
+		using FAlsAnimNode_GameplayTagsBlend::GetActiveChildIndex;
+	};
+
+	TArray<FGameplayTag> MakeOverlayModeTags()
+	{
+		return {
+			AlsOverlayModeTags::Default, AlsOverlayModeTags::Masculine, AlsOverlayModeTags::Feminine,
+			AlsOverlayModeTags::Injured, AlsOverlayModeTags::HandsTied, AlsOverlayModeTags::Rifle,
+			AlsOverlayModeTags::PistolOneHanded, AlsOverlayModeTags::PistolTwoHanded, AlsOverlayModeTags::Bow,
+			AlsOverlayModeTags::Torch, AlsOverlayModeTags::Binoculars, AlsOverlayModeTags::Box, AlsOverlayModeTags::Barrel
+		};
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsGameplayTagsBlendChangedTagsTest, "Als.GameplayTagsBlend.ChangedTags",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsGameplayTagsBlendChangedTagsTest::RunTest(const FString& Parameters)
+{
+	AlsGameplayTagsBlendTests::FTestNode Node;
+	Node.Tags = {AlsOverlayModeTags::Default, AlsOverlayModeTags::Rifle};
+
+	Node.ActiveTag = AlsOverlayModeTags::Rifle;
+	TestEqual(TEXT("Initial tags"), Node.GetActiveChildIndex(), 2);
+
+	Node.ActiveTag = AlsOverlayModeTags::Bow;
+	TestEqual(TEXT("Missing tag"), Node.GetActiveChildIndex(), 0);
+
+	// Changing the tags this way simulates tags exposed as a pin.
+
+	Node.Tags.Add(AlsOverlayModeTags::Bow);
+	TestEqual(TEXT("Added tag"), Node.GetActiveChildIndex(), 3);
+
+	Node.Tags.RemoveAt(0);
+	TestEqual(TEXT("Removed tag"), Node.GetActiveChildIndex(), 2);
+
+	Node.ActiveTag = AlsOverlayModeTags::Rifle;
+	TestEqual(TEXT("Shifted tag"), Node.GetActiveChildIndex(), 1);
+
+	Node.Tags.Remove(AlsOverlayModeTags::Rifle);
+	TestEqual(TEXT("Removed active tag"), Node.GetActiveChildIndex(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsGameplayTagsBlendBenchmarkTest, "Als.GameplayTagsBlend.Benchmark",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FAlsGameplayTagsBlendBenchmarkTest::RunTest(const FString& Parameters)
+{
+	// Compares the child index lookup of the node with the linear search it replaced. The active tag changes
+	// on every iteration, so the previous result is never reused and every call goes through the map.
+
+	static constexpr auto IterationsCount{1000000};
+
+	AlsGameplayTagsBlendTests::FTestNode Node;
+	Node.Tags = AlsGameplayTagsBlendTests::MakeOverlayModeTags();
+
+	// Tags at the end of the array are the worst case for the linear search, and the missing tag is the worst case for both.
+
+	const FGameplayTag ActiveTags[]{
+		AlsOverlayModeTags::Default, AlsOverlayModeTags::Bow, AlsOverlayModeTags::Barrel, AlsLocomotionActionTags::Rolling
+	};
+
+	static constexpr auto ActiveTagsCount{static_cast<int32>(UE_ARRAY_COUNT(ActiveTags))};
+
+	for (auto i{0}; i < ActiveTagsCount; i++)
+	{
+		Node.ActiveTag = ActiveTags[i];
+		TestEqual(FString::Printf(TEXT("Child index of %s"), *ActiveTags[i].ToString()),
+		          Node.GetActiveChildIndex(), Node.Tags.Find(ActiveTags[i]) + 1);
+	}
+
+	auto MapChildIndicesSum{0};
+
+	const auto MapStartTime{FPlatformTime::Seconds()};
+
+	for (auto i{0}; i < IterationsCount; i++)
+	{
+		Node.ActiveTag = ActiveTags[i % ActiveTagsCount];
+		MapChildIndicesSum += Node.GetActiveChildIndex();
+	}
+
+	const auto MapDuration{FPlatformTime::Seconds() - MapStartTime};
+
+	auto LinearChildIndicesSum{0};
+
+	const auto LinearStartTime{FPlatformTime::Seconds()};
+
+	for (auto i{0}; i < IterationsCount; i++)
+	{
+		LinearChildIndicesSum += Node.Tags.Find(ActiveTags[i % ActiveTagsCount]) + 1;
+	}
+
+	const auto LinearDuration{FPlatformTime::Seconds() - LinearStartTime};
+
+	TestEqual(TEXT("Child indices sum"), MapChildIndicesSum, LinearChildIndicesSum);
+
+	AddInfo(FString::Printf(TEXT("%d tags, %d lookups: GetActiveChildIndex %.3f ms, Tags.Find %.3f ms."),
+	                        Node.Tags.Num(), IterationsCount, MapDuration * 1000.0, LinearDuration * 1000.0));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,71 @@
+#include "Animation/AnimMontage.h"
+#include "Misc/AutomationTest.h"
+#include "Settings/AlsMantlingSettings.h"
+#include "Utility/AlsMontageUtility.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMantlingSettingsRootMotionTest, "Als.MantlingSettings.RootMotion",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMantlingSettingsRootMotionTest::RunTest(const FString& Parameters)
+{
+	static constexpr auto LocationTolerance{1.0f};
+	static constexpr auto TimesCount{97};
+
+	static const TCHAR* MantlingSettingsPaths[]{
+		TEXT("/ALS/ALS/Data/Character/Mantle/MS_Als_High.MS_Als_High"),
+		TEXT("/ALS/ALS/Data/Character/Mantle/MS_Als_Low.MS_Als_Low"),
+		TEXT("/ALS/ALS/Data/Character/Mantle/MS_Als_Low_Left.MS_Als_Low_Left"),
+		TEXT("/ALS/ALS/Data/Character/Mantle/MS_Als_Low_Right.MS_Als_Low_Right")
+	};
+
+	for (const auto* MantlingSettingsPath : MantlingSettingsPaths)
+	{
+		const auto* MantlingSettings{LoadObject<UAlsMantlingSettings>(nullptr, MantlingSettingsPath)};
+		if (!TestNotNull(MantlingSettingsPath, MantlingSettings) || !TestNotNull(MantlingSettingsPath, MantlingSettings->Montage.Get()))
+		{
+			continue;
+		}
+
+		const auto* Montage{MantlingSettings->Montage.Get()};
+		const auto PlayLength{Montage->GetPlayLength()};
+
+		// The times are deliberately not aligned with the montage frame rate, so the interpolation between samples is tested too.
+
+		for (auto i{0}; i < TimesCount; i++)
+		{
+			const auto Time{PlayLength * static_cast<float>(i) / static_cast<float>(TimesCount - 1)};
+
+			const auto ExpectedLocation{UAlsMontageUtility::ExtractRootTransformFromMontage(Montage, Time).GetLocation()};
+			const auto Location{MantlingSettings->GetRootMotionLocation(Time)};
+
+			TestEqual(FString::Printf(TEXT("%s: location at %.3f s"), MantlingSettingsPath, Time),
+			          Location, ExpectedLocation, LocationTolerance);
+		}
+
+		TestEqual(FString::Printf(TEXT("%s: last location"), MantlingSettingsPath), MantlingSettings->GetLastRootMotionLocation(),
+		          UAlsMontageUtility::ExtractLastRootTransformFromMontage(Montage).GetLocation(), LocationTolerance);
+
+		// The time found by the vertical location must map back to the same vertical location.
+
+		const auto StartLocationZ{MantlingSettings->GetRootMotionLocation(0.0f).Z};
+		const auto EndLocationZ{MantlingSettings->GetLastRootMotionLocation().Z};
+
+		for (auto i{1}; i < TimesCount - 1; i++)
+		{
+			const auto LocationZ{FMath::Lerp(StartLocationZ, EndLocationZ, static_cast<float>(i) / static_cast<float>(TimesCount - 1))};
+			const auto Time{MantlingSettings->FindRootMotionTimeByLocationZ(UE_REAL_TO_FLOAT(LocationZ))};
+
+			TestTrue(FString::Printf(TEXT("%s: time by location %.2f is within the montage"), MantlingSettingsPath, LocationZ),
+			         Time >= 0.0f && Time <= PlayLength);
+
+			TestEqual(FString::Printf(TEXT("%s: location at time by location %.2f"), MantlingSettingsPath, LocationZ),
+			          MantlingSettings->GetRootMotionLocation(Time).Z, LocationZ, static_cast<double>(LocationTolerance));
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,228 @@
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveVector.h"
+#include "Misc/AutomationTest.h"
+#include "Settings/AlsMovementSettings.h"
+#include "UObject/CoreNet.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsMovementSettingsTests
+{
+	void AddCubicKeys(FRichCurve& Curve, const TArray<FVector2f>& Keys)
+	{
+		for (const auto& Key : Keys)
+		{
+			Curve.SetKeyInterpMode(Curve.AddKey(Key.X, Key.Y), RCIM_Cubic);
+		}
+	}
+
+	FAlsMovementGaitSettings CreateGaitSettings()
+	{
+		auto* AccelerationCurve{NewObject<UCurveVector>()};
+		AddCubicKeys(AccelerationCurve->FloatCurves[0], {{0.0f, 800.0f}, {1.0f, 1000.0f}, {2.0f, 1500.0f}, {3.0f, 2500.0f}});
+		AddCubicKeys(AccelerationCurve->FloatCurves[1], {{0.0f, 2000.0f}, {1.0f, 1500.0f}, {2.0f, 1000.0f}, {3.0f, 500.0f}});
+		AddCubicKeys(AccelerationCurve->FloatCurves[2], {{0.0f, 8.0f}, {1.0f, 8.0f}, {2.0f, 6.0f}, {3.0f, 4.0f}});
+
+		auto* RotationCurve{NewObject<UCurveFloat>()};
+		AddCubicKeys(RotationCurve->FloatCurve, {{0.0f, 10.0f}, {1.0f, 12.0f}, {2.0f, 8.0f}, {3.0f, 6.0f}});
+
+		FAlsMovementGaitSettings GaitSettings;
+		GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve = AccelerationCurve;
+		GaitSettings.RotationInterpolationSpeedCurve = RotationCurve;
+		GaitSettings.bUseBakedCurves = true;
+
+		return GaitSettings;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMovementSettingsBakedCurvesTest, "Als.MovementSettings.BakedCurves",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMovementSettingsBakedCurvesTest::RunTest(const FString& Parameters)
+{
+	static constexpr auto MaxGaitAmount{3.0f};
+	static constexpr auto GaitAmountsCount{301};
+
+	// The test curves are smooth, so the lookup tables should stay within half a percent of the value ranges.
+
+	static constexpr auto MaxAccelerationError{10.0f};
+	static constexpr auto MaxGroundFrictionError{0.02f};
+	static constexpr auto MaxRotationInterpolationSpeedError{0.03f};
+
+	const auto GaitSettings{AlsMovementSettingsTests::CreateGaitSettings()};
+
+	FAlsMovementBakedGaitCurves BakedCurves;
+	BakedCurves.Bake(GaitSettings);
+
+	TestTrue(TEXT("Acceleration curve baked"), BakedCurves.bAccelerationAndDecelerationAndGroundFrictionBaked);
+	TestTrue(TEXT("Rotation interpolation speed curve baked"), BakedCurves.bRotationInterpolationSpeedBaked);
+
+	for (auto i{0}; i < GaitAmountsCount; i++)
+	{
+		const auto GaitAmount{MaxGaitAmount * i / (GaitAmountsCount - 1)};
+
+		TestEqual(FString::Printf(TEXT("Acceleration at %.2f"), GaitAmount),
+		          GaitSettings.GetAccelerationByGaitAmount(GaitAmount, &BakedCurves),
+		          GaitSettings.GetAccelerationByGaitAmount(GaitAmount, nullptr), MaxAccelerationError);
+
+		TestEqual(FString::Printf(TEXT("Deceleration at %.2f"), GaitAmount),
+		          GaitSettings.GetDecelerationByGaitAmount(GaitAmount, &BakedCurves),
+		          GaitSettings.GetDecelerationByGaitAmount(GaitAmount, nullptr), MaxAccelerationError);
+
+		TestEqual(FString::Printf(TEXT("Ground friction at %.2f"), GaitAmount),
+		          GaitSettings.GetGroundFrictionByGaitAmount(GaitAmount, &BakedCurves),
+		          GaitSettings.GetGroundFrictionByGaitAmount(GaitAmount, nullptr), MaxGroundFrictionError);
+
+		TestEqual(FString::Printf(TEXT("Rotation interpolation speed at %.2f"), GaitAmount),
+		          GaitSettings.GetRotationInterpolationSpeedByGaitAmount(GaitAmount, &BakedCurves),
+		          GaitSettings.GetRotationInterpolationSpeedByGaitAmount(GaitAmount, nullptr), MaxRotationInterpolationSpeedError);
+	}
+
+	// The walking, running, and sprinting gait amounts fall exactly on the samples.
+
+	for (auto GaitAmount{0.0f}; GaitAmount <= MaxGaitAmount; GaitAmount += 1.0f)
+	{
+		TestEqual(FString::Printf(TEXT("Exact acceleration at %.0f"), GaitAmount),
+		          GaitSettings.GetAccelerationByGaitAmount(GaitAmount, &BakedCurves),
+		          GaitSettings.GetAccelerationByGaitAmount(GaitAmount, nullptr), KINDA_SMALL_NUMBER);
+
+		TestEqual(FString::Printf(TEXT("Exact rotation interpolation speed at %.0f"), GaitAmount),
+		          GaitSettings.GetRotationInterpolationSpeedByGaitAmount(GaitAmount, &BakedCurves),
+		          GaitSettings.GetRotationInterpolationSpeedByGaitAmount(GaitAmount, nullptr), KINDA_SMALL_NUMBER);
+	}
+
+	TestTrue(TEXT("Max error is within the acceleration tolerance"), BakedCurves.CalculateMaxError(GaitSettings) <= MaxAccelerationError);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMovementSettingsGaitSettingsTableTest, "Als.MovementSettings.GaitSettingsTable",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMovementSettingsGaitSettingsTableTest::RunTest(const FString& Parameters)
+{
+	// Settings created at runtime are never loaded, so the table must be built on first use.
+
+	auto* MovementSettings{NewObject<UAlsMovementSettings>()};
+
+	auto GaitSettings{AlsMovementSettingsTests::CreateGaitSettings()};
+	GaitSettings.WalkSpeed = 123.0f;
+
+	MovementSettings->RotationModes.FindChecked(AlsRotationModeTags::Aiming).Stances.Add(AlsStanceTags::Crouching, GaitSettings);
+
+	const auto* TableGaitSettings{MovementSettings->FindGaitSettings(AlsRotationModeTags::Aiming, AlsStanceTags::Crouching)};
+	if (!TestNotNull(TEXT("Gait settings"), TableGaitSettings))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Walk speed"), TableGaitSettings->WalkSpeed, 123.0f);
+	TestNotNull(TEXT("Baked curves"), MovementSettings->FindBakedGaitCurves(TableGaitSettings->TableIndex));
+
+	TestNull(TEXT("Not baked gait settings"), MovementSettings->FindBakedGaitCurves(
+		         MovementSettings->FindGaitSettings(AlsRotationModeTags::Aiming, AlsStanceTags::Standing)->TableIndex));
+
+	// Copies of the gait settings must keep resolving the baked curves of their own entry after the table is
+	// rebuilt, even when the baking of an earlier entry is toggled, which changes how many entries are baked.
+
+	const auto GaitSettingsCopy{*TableGaitSettings};
+
+	auto EarlierGaitSettings{AlsMovementSettingsTests::CreateGaitSettings()};
+	EarlierGaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[0].Reset();
+	EarlierGaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[0].AddKey(0.0f, 1.0f);
+
+	MovementSettings->RotationModes.FindChecked(AlsRotationModeTags::VelocityDirection).Stances
+	                .Add(AlsStanceTags::Standing, EarlierGaitSettings);
+	MovementSettings->RefreshGaitSettingsTable();
+
+	const auto* RebuiltBakedCurves{MovementSettings->FindBakedGaitCurves(GaitSettingsCopy.TableIndex)};
+	if (TestNotNull(TEXT("Rebuilt baked curves"), RebuiltBakedCurves))
+	{
+		TestEqual(TEXT("Rebuilt baked curves acceleration"),
+		          GaitSettingsCopy.GetAccelerationByGaitAmount(1.5f, RebuiltBakedCurves),
+		          GaitSettingsCopy.GetAccelerationByGaitAmount(1.5f, nullptr), 10.0f);
+	}
+
+	TestNull(TEXT("Missing gait settings"), MovementSettings->FindGaitSettings(AlsRotationModeTags::Aiming, FGameplayTag::EmptyTag));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMovementSettingsNetSerializeTagsTest, "Als.MovementSettings.NetSerializeTags",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMovementSettingsNetSerializeTagsTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsMovementSettingsIndices;
+
+	using FNetSerializeFunction = void (*)(FArchive& Archive, UPackageMap* Map, FGameplayTag& Tag);
+
+	struct FFamily
+	{
+		const TCHAR* Name;
+		TConstArrayView<FGameplayTag> KnownTags;
+		FNetSerializeFunction NetSerialize;
+		int32 (*GetIndex)(const FGameplayTag& Tag);
+		FGameplayTag (*GetByIndex)(int32 Index);
+	};
+
+	const FFamily Families[]{
+		{TEXT("RotationMode"), GetRotationModes(), &NetSerializeRotationMode, &GetRotationModeIndex, &GetRotationModeByIndex},
+		{TEXT("Stance"), GetStances(), &NetSerializeStance, &GetStanceIndex, &GetStanceByIndex},
+		{TEXT("Gait"), GetGaits(), &NetSerializeGait, &GetGaitIndex, &GetGaitByIndex}
+	};
+
+	// A tag that is not built into any of the families, so it must be sent in full.
+
+	const FGameplayTag CustomTag{AlsOverlayModeTags::Default};
+
+	for (const auto& Family : Families)
+	{
+		TArray<FGameplayTag> Tags{Family.KnownTags};
+		Tags.Add(CustomTag);
+		Tags.Add(FGameplayTag::EmptyTag);
+
+		for (auto i{0}; i < Family.KnownTags.Num(); i++)
+		{
+			TestEqual(FString::Printf(TEXT("%s: index of %s"), Family.Name, *Family.KnownTags[i].ToString()),
+			          Family.GetIndex(Family.KnownTags[i]), i);
+
+			TestTrue(FString::Printf(TEXT("%s: tag by index %d"), Family.Name, i),
+			         Family.GetByIndex(i) == Family.KnownTags[i]);
+		}
+
+		TestEqual(FString::Printf(TEXT("%s: index of custom tag"), Family.Name), Family.GetIndex(CustomTag), INDEX_NONE);
+		TestFalse(FString::Printf(TEXT("%s: tag by invalid index"), Family.Name), Family.GetByIndex(Family.KnownTags.Num()).IsValid());
+
+		// Write all tags into one stream so that a wrong bit width breaks the tags that follow it.
+
+		FNetBitWriter Writer{nullptr, 256};
+
+		for (auto Tag : Tags)
+		{
+			Family.NetSerialize(Writer, nullptr, Tag);
+		}
+
+		if (!TestFalse(FString::Printf(TEXT("%s: write error"), Family.Name), Writer.IsError()))
+		{
+			continue;
+		}
+
+		FNetBitReader Reader{nullptr, Writer.GetData(), Writer.GetNumBits()};
+
+		for (const auto& ExpectedTag : Tags)
+		{
+			FGameplayTag Tag{AlsOverlayModeTags::Masculine};
+			Family.NetSerialize(Reader, nullptr, Tag);
+
+			TestTrue(FString::Printf(TEXT("%s: round trip of %s"), Family.Name, *ExpectedTag.ToString()), Tag == ExpectedTag);
+		}
+
+		TestFalse(FString::Printf(TEXT("%s: read error"), Family.Name), Reader.IsError());
+		TestEqual(FString::Printf(TEXT("%s: bits left"), Family.Name), Reader.GetBitsLeft(), static_cast<int64>(0));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,193 @@
+#include "Misc/AutomationTest.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+#include "Settings/AlsRollingSettings.h"
+
+#if UE_WITH_IRIS
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializationContext.h"
+#include "Utility/AlsNetSerializers.h"
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsRollingSettingsTests
+{
+	FAlsRollingParameters MakeParameters(const float PlayRate, const float InitialYawAngle, const float TargetYawAngle)
+	{
+		FAlsRollingParameters Parameters;
+		Parameters.PlayRate = PlayRate;
+		Parameters.InitialYawAngle = InitialYawAngle;
+		Parameters.TargetYawAngle = TargetYawAngle;
+
+		return Parameters;
+	}
+
+	TArray<FAlsRollingParameters> GetTestParameters()
+	{
+		return {
+			MakeParameters(1.0f, 0.0f, 0.0f),
+			MakeParameters(1.37f, -179.99f, 179.99f),
+			MakeParameters(0.004f, 45.123f, -90.001f),
+			MakeParameters(2.5f, 359.9f, -720.3f),
+			MakeParameters(0.995f, 0.0027f, 123.456f)
+		};
+	}
+
+	FAlsRollingParameters RoundTripQuantize(const FAlsRollingParameters& Parameters)
+	{
+		return MakeParameters(
+			FAlsRollingParameters::DequantizePlayRate(FAlsRollingParameters::QuantizePlayRate(Parameters.PlayRate)),
+			FAlsRollingParameters::DequantizeYawAngle(FAlsRollingParameters::QuantizeYawAngle(Parameters.InitialYawAngle)),
+			FAlsRollingParameters::DequantizeYawAngle(FAlsRollingParameters::QuantizeYawAngle(Parameters.TargetYawAngle)));
+	}
+
+	bool IsIdentical(const FAlsRollingParameters& A, const FAlsRollingParameters& B)
+	{
+		return A.PlayRate == B.PlayRate && A.InitialYawAngle == B.InitialYawAngle && A.TargetYawAngle == B.TargetYawAngle;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsRollingSettingsQuantizeTest, "Als.RollingSettings.Quantize",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsRollingSettingsQuantizeTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsRollingSettingsTests;
+
+	// The play rate is rounded to a step of 0.01, and yaw angles are rounded to a step of 360 / 65536 degrees.
+
+	static constexpr auto MaxPlayRateError{0.005f + UE_KINDA_SMALL_NUMBER};
+	static constexpr auto MaxYawAngleError{180.0f / 65536.0f + UE_KINDA_SMALL_NUMBER};
+
+	const auto TestParameters{GetTestParameters()};
+
+	for (auto i{0}; i < TestParameters.Num(); i++)
+	{
+		const auto& Source{TestParameters[i]};
+		const auto Quantized{RoundTripQuantize(Source)};
+
+		TestTrue(FString::Printf(TEXT("%d: play rate error"), i),
+		         FMath::Abs(Quantized.PlayRate - Source.PlayRate) <= MaxPlayRateError);
+
+		TestTrue(FString::Printf(TEXT("%d: initial yaw angle error"), i),
+		         FMath::Abs(FRotator3f::NormalizeAxis(Quantized.InitialYawAngle - Source.InitialYawAngle)) <= MaxYawAngleError);
+
+		TestTrue(FString::Printf(TEXT("%d: target yaw angle error"), i),
+		         FMath::Abs(FRotator3f::NormalizeAxis(Quantized.TargetYawAngle - Source.TargetYawAngle)) <= MaxYawAngleError);
+
+		// The local side uses already quantized parameters, so quantizing them again must not change them.
+
+		TestTrue(FString::Printf(TEXT("%d: stable"), i), IsIdentical(RoundTripQuantize(Quantized), Quantized));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsRollingSettingsNetSerializeTest, "Als.RollingSettings.NetSerialize",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsRollingSettingsNetSerializeTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsRollingSettingsTests;
+
+	auto TestParameters{GetTestParameters()};
+
+	for (auto i{0}; i < TestParameters.Num(); i++)
+	{
+		auto& Source{TestParameters[i]};
+		auto bSuccess{true};
+
+		FBitWriter Writer{0, true};
+		Source.NetSerialize(Writer, nullptr, bSuccess);
+
+		auto Received{MakeParameters(-1.0f, -1.0f, -1.0f)};
+
+		FBitReader Reader{Writer.GetData(), Writer.GetNumBits()};
+		Received.NetSerialize(Reader, nullptr, bSuccess);
+
+		TestTrue(FString::Printf(TEXT("%d: success"), i), bSuccess && !Writer.IsError() && !Reader.IsError());
+		TestTrue(FString::Printf(TEXT("%d: round trip"), i), IsIdentical(Received, RoundTripQuantize(Source)));
+	}
+
+	return true;
+}
+
+#if UE_WITH_IRIS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsRollingSettingsIrisNetSerializerTest, "Als.RollingSettings.IrisNetSerializer",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsRollingSettingsIrisNetSerializerTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsRollingSettingsTests;
+	using namespace UE::Net;
+
+	const auto& Serializer{UE_NET_GET_SERIALIZER(FAlsRollingParametersNetSerializer)};
+
+	alignas(16) uint8 QuantizedSource[64];
+	alignas(16) uint8 QuantizedTarget[64];
+
+	if (!TestTrue(TEXT("Quantized type size"), Serializer.QuantizedTypeSize <= sizeof(QuantizedSource)))
+	{
+		return false;
+	}
+
+	const auto TestParameters{GetTestParameters()};
+
+	for (auto i{0}; i < TestParameters.Num(); i++)
+	{
+		const auto& Source{TestParameters[i]};
+
+		alignas(16) uint32 Buffer[16];
+
+		FNetBitStreamWriter Writer;
+		Writer.InitBytes(Buffer, sizeof(Buffer));
+
+		FNetSerializationContext WriterContext{&Writer};
+
+		FNetQuantizeArgs QuantizeArgs{};
+		QuantizeArgs.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+		QuantizeArgs.Source = NetSerializerValuePointer(&Source);
+		QuantizeArgs.Target = NetSerializerValuePointer(QuantizedSource);
+		Serializer.Quantize(WriterContext, QuantizeArgs);
+
+		FNetSerializeArgs SerializeArgs{};
+		SerializeArgs.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+		SerializeArgs.Source = NetSerializerValuePointer(QuantizedSource);
+		Serializer.Serialize(WriterContext, SerializeArgs);
+
+		Writer.CommitWrites();
+
+		FNetBitStreamReader Reader;
+		Reader.InitBits(Buffer, Writer.GetPosBits());
+
+		FNetSerializationContext ReaderContext{&Reader};
+
+		FNetDeserializeArgs DeserializeArgs{};
+		DeserializeArgs.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+		DeserializeArgs.Target = NetSerializerValuePointer(QuantizedTarget);
+		Serializer.Deserialize(ReaderContext, DeserializeArgs);
+
+		auto Received{MakeParameters(-1.0f, -1.0f, -1.0f)};
+
+		FNetDequantizeArgs DequantizeArgs{};
+		DequantizeArgs.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+		DequantizeArgs.Source = NetSerializerValuePointer(QuantizedTarget);
+		DequantizeArgs.Target = NetSerializerValuePointer(&Received);
+		Serializer.Dequantize(ReaderContext, DequantizeArgs);
+
+		TestFalse(FString::Printf(TEXT("%d: error"), i), WriterContext.HasErrorOrOverflow() || ReaderContext.HasErrorOrOverflow());
+
+		// Both replication systems must deliver identical values.
+
+		TestTrue(FString::Printf(TEXT("%d: round trip"), i), IsIdentical(Received, RoundTripQuantize(Source)));
+	}
+
+	return true;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,45 @@
+#include "AlsSignificanceSubsystem.h"
+#include "Misc/AutomationTest.h"
+#include "Settings/AlsLodSettings.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsSignificanceSubsystemLodLevelTest, "Als.SignificanceSubsystem.LodLevel",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsSignificanceSubsystemLodLevelTest::RunTest(const FString& Parameters)
+{
+	FAlsLodSettings LodSettings;
+	LodSettings.ReducedLodDistance = 1000.0f;
+	LodSettings.MinimalLodDistance = 2000.0f;
+	LodSettings.bLowerLodWhenNotRendered = true;
+
+	const auto CalculateLodLevel{
+		[&LodSettings](const float ViewDistance, const bool bLocallyControlled, const bool bRecentlyRendered)
+		{
+			return UAlsSignificanceSubsystem::CalculateLodLevel(LodSettings, FMath::Square(ViewDistance),
+			                                                    bLocallyControlled, bRecentlyRendered);
+		}
+	};
+
+	TestEqual(TEXT("Near"), CalculateLodLevel(500.0f, false, true), EAlsLodLevel::Full);
+	TestEqual(TEXT("At reduced distance"), CalculateLodLevel(1000.0f, false, true), EAlsLodLevel::Full);
+	TestEqual(TEXT("Beyond reduced distance"), CalculateLodLevel(1500.0f, false, true), EAlsLodLevel::Reduced);
+	TestEqual(TEXT("Beyond minimal distance"), CalculateLodLevel(2500.0f, false, true), EAlsLodLevel::Minimal);
+
+	TestEqual(TEXT("Near, not rendered"), CalculateLodLevel(500.0f, false, false), EAlsLodLevel::Reduced);
+	TestEqual(TEXT("Beyond reduced distance, not rendered"), CalculateLodLevel(1500.0f, false, false), EAlsLodLevel::Minimal);
+	TestEqual(TEXT("Beyond minimal distance, not rendered"), CalculateLodLevel(2500.0f, false, false), EAlsLodLevel::Minimal);
+
+	TestEqual(TEXT("Locally controlled"), CalculateLodLevel(2500.0f, true, false), EAlsLodLevel::Full);
+
+	LodSettings.bLowerLodWhenNotRendered = false;
+
+	TestEqual(TEXT("Near, not rendered, not lowered"), CalculateLodLevel(500.0f, false, false), EAlsLodLevel::Full);
+	TestEqual(TEXT("Beyond reduced distance, not rendered, not lowered"),
+	          CalculateLodLevel(1500.0f, false, false), EAlsLodLevel::Reduced);
+
+	return true;
+}
+
+#endif
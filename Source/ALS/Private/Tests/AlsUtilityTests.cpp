@@ -0,0 +1,42 @@
+#include "Misc/AutomationTest.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+#include "Utility/AlsUtility.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsUtilityRoundTripNetQuantizeTest, "Als.Utility.RoundTripNetQuantize",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsUtilityRoundTripNetQuantizeTest::RunTest(const FString& Parameters)
+{
+	// FVector_NetQuantize rounds each component to a whole centimeter.
+
+	static constexpr auto MaxError{0.5f + UE_KINDA_SMALL_NUMBER};
+
+	const FVector Locations[]{
+		FVector::ZeroVector,
+		{0.25, -0.25, 0.75},
+		{12.5, -12.5, 1.49},
+		{1234.567, -8901.234, 56.789},
+		{-104857.3, 104857.3, -0.6},
+		{1048575.4, -1048575.4, 333.333}
+	};
+
+	for (const auto& Location : Locations)
+	{
+		const auto Quantized{UAlsUtility::RoundTripNetQuantize(Location)};
+
+		TestEqual(FString::Printf(TEXT("%s: error"), *Location.ToString()), Quantized, Location, MaxError);
+
+		// The sending side must end up with exactly the same value as the receiving sides,
+		// so sending an already quantized location again must not change it.
+
+		TestTrue(FString::Printf(TEXT("%s: stable"), *Location.ToString()),
+		         UAlsUtility::RoundTripNetQuantize(Quantized) == Quantized);
+	}
+
+	return true;
+}
+
+#endif
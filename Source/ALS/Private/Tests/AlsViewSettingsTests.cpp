@@ -0,0 +1,226 @@
+#include "Misc/AutomationTest.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+#include "Settings/AlsViewSettings.h"
+
+#if UE_WITH_IRIS
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializationContext.h"
+#include "Utility/AlsNetSerializers.h"
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsViewSettingsTests
+{
+	const FRotator Rotations[]{
+		FRotator::ZeroRotator,
+		{0.001, -0.001, 0.001},
+		{45.0027, 90.0014, 12.0},
+		{-89.9999, 179.9999, -45.0},
+		{89.9999, -179.9999, 180.0},
+		{-12.3456, 359.9989, 0.5},
+		{33.3333, -721.2345, -90.0}
+	};
+
+	static constexpr int32 AxisBitsCounts[]{8, 12, 16};
+
+	FAlsReplicatedViewRotation MakeViewRotation(const FRotator& Rotation, const int32 AxisBitsCount)
+	{
+		FAlsReplicatedViewRotation ViewRotation;
+		ViewRotation.AxisBitsCount = static_cast<uint8>(AxisBitsCount);
+		ViewRotation.Rotation = AxisBitsCount > 0 ? FAlsReplicatedViewRotation::Quantize(Rotation, AxisBitsCount) : Rotation;
+
+		return ViewRotation;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsViewSettingsQuantizeTest, "Als.ViewSettings.Quantize",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsViewSettingsQuantizeTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsViewSettingsTests;
+
+	for (const auto AxisBitsCount : AxisBitsCounts)
+	{
+		// Angles are rounded to the nearest step of 360 / 2 ^ AxisBitsCount degrees.
+
+		const auto MaxError{180.0 / (1 << AxisBitsCount) + UE_KINDA_SMALL_NUMBER};
+
+		for (const auto& Rotation : Rotations)
+		{
+			const auto Quantized{FAlsReplicatedViewRotation::Quantize(Rotation, AxisBitsCount)};
+
+			TestTrue(FString::Printf(TEXT("%d bits, %s: pitch error"), AxisBitsCount, *Rotation.ToString()),
+			         FMath::Abs(FRotator::NormalizeAxis(Quantized.Pitch - Rotation.Pitch)) <= MaxError);
+
+			TestTrue(FString::Printf(TEXT("%d bits, %s: yaw error"), AxisBitsCount, *Rotation.ToString()),
+			         FMath::Abs(FRotator::NormalizeAxis(Quantized.Yaw - Rotation.Yaw)) <= MaxError);
+
+			TestEqual(FString::Printf(TEXT("%d bits, %s: roll"), AxisBitsCount, *Rotation.ToString()), Quantized.Roll, 0.0);
+
+			// The local side uses the already quantized rotation, so quantizing it again must not change it.
+
+			TestTrue(FString::Printf(TEXT("%d bits, %s: stable"), AxisBitsCount, *Rotation.ToString()),
+			         FAlsReplicatedViewRotation::Quantize(Quantized, AxisBitsCount) == Quantized);
+		}
+	}
+
+	// The 16-bit grid is the same as the one used to serialize regular rotators.
+
+	for (const auto& Rotation : Rotations)
+	{
+		TestEqual(FString::Printf(TEXT("%s: 16-bit pitch"), *Rotation.ToString()),
+		          FAlsReplicatedViewRotation::QuantizeAxis(Rotation.Pitch, 16),
+		          static_cast<uint32>(FRotator::CompressAxisToShort(Rotation.Pitch)));
+
+		TestEqual(FString::Printf(TEXT("%s: 16-bit yaw"), *Rotation.ToString()),
+		          FAlsReplicatedViewRotation::QuantizeAxis(Rotation.Yaw, 16),
+		          static_cast<uint32>(FRotator::CompressAxisToShort(Rotation.Yaw)));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsViewSettingsNetSerializeTest, "Als.ViewSettings.NetSerialize",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsViewSettingsNetSerializeTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsViewSettingsTests;
+
+	for (const auto AxisBitsCount : AxisBitsCounts)
+	{
+		for (const auto& Rotation : Rotations)
+		{
+			auto Source{MakeViewRotation(Rotation, AxisBitsCount)};
+			auto bSuccess{true};
+
+			FBitWriter Writer{0, true};
+			Source.NetSerialize(Writer, nullptr, bSuccess);
+
+			FAlsReplicatedViewRotation Received;
+			Received.Rotation = {-1.0f, -1.0f, -1.0f};
+
+			FBitReader Reader{Writer.GetData(), Writer.GetNumBits()};
+			Received.NetSerialize(Reader, nullptr, bSuccess);
+
+			const auto Name{FString::Printf(TEXT("%d bits, %s"), AxisBitsCount, *Rotation.ToString())};
+
+			TestTrue(Name + TEXT(": success"), bSuccess && !Writer.IsError() && !Reader.IsError());
+			TestEqual(Name + TEXT(": axis bits count"), Received.AxisBitsCount, Source.AxisBitsCount);
+
+			// Remote sides must receive exactly the rotation the local side uses.
+
+			TestTrue(Name + TEXT(": round trip"), Received.Rotation == Source.Rotation);
+
+			// The bits count of the axes is sent in up to 5 bits, and the pitch and yaw use the configured number of bits each.
+
+			TestTrue(Name + TEXT(": size"), Writer.GetNumBits() <= 5 + AxisBitsCount * 2);
+		}
+	}
+
+	// Without quantization, the rotation is sent as a regular rotator, including the roll.
+
+	auto Source{MakeViewRotation({10.0, 20.0, 30.0}, 0)};
+	auto bSuccess{true};
+
+	FBitWriter Writer{0, true};
+	Source.NetSerialize(Writer, nullptr, bSuccess);
+
+	FAlsReplicatedViewRotation Received;
+
+	FBitReader Reader{Writer.GetData(), Writer.GetNumBits()};
+	Received.NetSerialize(Reader, nullptr, bSuccess);
+
+	TestTrue(TEXT("Not quantized: success"), bSuccess && !Writer.IsError() && !Reader.IsError());
+	TestEqual(TEXT("Not quantized: axis bits count"), Received.AxisBitsCount, static_cast<uint8>(0));
+	TestTrue(TEXT("Not quantized: round trip"), Received.Rotation.Equals(Source.Rotation, 360.0 / 65536.0));
+
+	return true;
+}
+
+#if UE_WITH_IRIS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsViewSettingsIrisNetSerializerTest, "Als.ViewSettings.IrisNetSerializer",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsViewSettingsIrisNetSerializerTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsViewSettingsTests;
+	using namespace UE::Net;
+
+	const auto& Serializer{UE_NET_GET_SERIALIZER(FAlsReplicatedViewRotationNetSerializer)};
+
+	alignas(16) uint8 QuantizedSource[64];
+	alignas(16) uint8 QuantizedTarget[64];
+
+	if (!TestTrue(TEXT("Quantized type size"), Serializer.QuantizedTypeSize <= sizeof(QuantizedSource)))
+	{
+		return false;
+	}
+
+	for (const auto AxisBitsCount : AxisBitsCounts)
+	{
+		for (const auto& Rotation : Rotations)
+		{
+			const auto Source{MakeViewRotation(Rotation, AxisBitsCount)};
+
+			alignas(16) uint32 Buffer[16];
+
+			FNetBitStreamWriter Writer;
+			Writer.InitBytes(Buffer, sizeof(Buffer));
+
+			FNetSerializationContext WriterContext{&Writer};
+
+			FNetQuantizeArgs QuantizeArgs{};
+			QuantizeArgs.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+			QuantizeArgs.Source = NetSerializerValuePointer(&Source);
+			QuantizeArgs.Target = NetSerializerValuePointer(QuantizedSource);
+			Serializer.Quantize(WriterContext, QuantizeArgs);
+
+			FNetSerializeArgs SerializeArgs{};
+			SerializeArgs.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+			SerializeArgs.Source = NetSerializerValuePointer(QuantizedSource);
+			Serializer.Serialize(WriterContext, SerializeArgs);
+
+			Writer.CommitWrites();
+
+			FNetBitStreamReader Reader;
+			Reader.InitBits(Buffer, Writer.GetPosBits());
+
+			FNetSerializationContext ReaderContext{&Reader};
+
+			FNetDeserializeArgs DeserializeArgs{};
+			DeserializeArgs.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+			DeserializeArgs.Target = NetSerializerValuePointer(QuantizedTarget);
+			Serializer.Deserialize(ReaderContext, DeserializeArgs);
+
+			FAlsReplicatedViewRotation Received;
+			Received.Rotation = {-1.0f, -1.0f, -1.0f};
+
+			FNetDequantizeArgs DequantizeArgs{};
+			DequantizeArgs.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+			DequantizeArgs.Source = NetSerializerValuePointer(QuantizedTarget);
+			DequantizeArgs.Target = NetSerializerValuePointer(&Received);
+			Serializer.Dequantize(ReaderContext, DequantizeArgs);
+
+			const auto Name{FString::Printf(TEXT("%d bits, %s"), AxisBitsCount, *Rotation.ToString())};
+
+			TestFalse(Name + TEXT(": error"), WriterContext.HasErrorOrOverflow() || ReaderContext.HasErrorOrOverflow());
+
+			// Both replication systems must deliver identical values.
+
+			TestEqual(Name + TEXT(": axis bits count"), Received.AxisBitsCount, Source.AxisBitsCount);
+			TestTrue(Name + TEXT(": round trip"), Received.Rotation == Source.Rotation);
+		}
+	}
+
+	return true;
+}
+
+#endif
+
+#endif
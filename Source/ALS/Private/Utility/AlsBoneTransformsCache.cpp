@@ -0,0 +1,70 @@
+#include "Utility/AlsBoneTransformsCache.h"
+
+#include "Components/SkinnedMeshComponent.h"
+#include "Engine/SkinnedAsset.h"
+
+void FAlsBoneTransformsCache::GetTransforms(const USkinnedMeshComponent& Mesh, const TConstArrayView<FName> NewNames,
+                                            const TArrayView<FTransform> Transforms)
+{
+	check(NewNames.Num() == Transforms.Num())
+
+	if (!IsResolvedFor(Mesh, NewNames))
+	{
+		Resolve(Mesh, NewNames);
+	}
+
+	const auto& ComponentTransform{Mesh.GetComponentTransform()};
+
+	for (auto i{0}; i < BoneIndices.Num(); i++)
+	{
+		const auto BoneIndex{BoneIndices[i]};
+
+		Transforms[i] = BoneIndex != INDEX_NONE
+			                ? LocalTransforms[i] * Mesh.GetBoneTransform(BoneIndex, ComponentTransform)
+			                : ComponentTransform;
+	}
+}
+
+bool FAlsBoneTransformsCache::IsResolvedFor(const USkinnedMeshComponent& Mesh, const TConstArrayView<FName> NewNames) const
+{
+	if (SkinnedAsset != Mesh.GetSkinnedAsset() || Names.Num() != NewNames.Num())
+	{
+		return false;
+	}
+
+	for (auto i{0}; i < Names.Num(); i++)
+	{
+		if (Names[i] != NewNames[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FAlsBoneTransformsCache::Resolve(const USkinnedMeshComponent& Mesh, const TConstArrayView<FName> NewNames)
+{
+	Names = NewNames;
+	SkinnedAsset = Mesh.GetSkinnedAsset();
+
+	BoneIndices.Reset(Names.Num());
+	LocalTransforms.Reset(Names.Num());
+
+	for (const auto& Name : Names)
+	{
+		// Sockets take precedence over bones, as in USkinnedMeshComponent::GetSocketTransform().
+
+		FTransform LocalTransform;
+		int32 BoneIndex;
+
+		if (Mesh.GetSocketInfoByName(Name, LocalTransform, BoneIndex) == nullptr)
+		{
+			LocalTransform = FTransform::Identity;
+			BoneIndex = Mesh.GetBoneIndex(Name);
+		}
+
+		BoneIndices.Add(BoneIndex);
+		LocalTransforms.Add(LocalTransform);
+	}
+}
@@ -0,0 +1,136 @@
+#include "Utility/AlsDebugTracesBuffer.h"
+
+#include "Engine/HitResult.h"
+#include "Utility/AlsDebugUtility.h"
+
+void FAlsDebugTracesBuffer::AddLineTraceSingle(const FVector& Start, const FVector& End, const bool bHit, const FHitResult& Hit,
+                                               const FLinearColor& TraceColor, const FLinearColor& HitColor, const float Duration)
+{
+	Add(EAlsDebugTraceType::LineTraceSingle, Start, End, bHit, &Hit, TraceColor, HitColor, Duration);
+}
+
+void FAlsDebugTracesBuffer::AddSweepSphere(const FVector& Start, const FVector& End, const float Radius,
+                                           const FLinearColor& Color, const float Duration)
+{
+	auto& Trace{Add(EAlsDebugTraceType::SweepSphere, Start, End, false, nullptr, Color, Color, Duration)};
+	Trace.Radius = Radius;
+}
+
+void FAlsDebugTracesBuffer::AddSweepSingleSphere(const FVector& Start, const FVector& End, const float Radius,
+                                                 const bool bHit, const FHitResult& Hit, const FLinearColor& SweepColor,
+                                                 const FLinearColor& HitColor, const float Duration)
+{
+	auto& Trace{Add(EAlsDebugTraceType::SweepSingleSphere, Start, End, bHit, &Hit, SweepColor, HitColor, Duration)};
+	Trace.Radius = Radius;
+}
+
+void FAlsDebugTracesBuffer::AddSweepSingleCapsule(const FVector& Start, const FVector& End, const FRotator& Rotation,
+                                                  const float Radius, const float HalfHeight, const bool bHit, const FHitResult& Hit,
+                                                  const FLinearColor& SweepColor, const FLinearColor& HitColor, const float Duration)
+{
+	auto& Trace{Add(EAlsDebugTraceType::SweepSingleCapsule, Start, End, bHit, &Hit, SweepColor, HitColor, Duration)};
+	Trace.Rotation = Rotation;
+	Trace.Radius = Radius;
+	Trace.HalfHeight = HalfHeight;
+}
+
+void FAlsDebugTracesBuffer::AddSweepSingleCapsuleAlternative(const FVector& Start, const FVector& End, const float Radius,
+                                                             const float HalfHeight, const bool bHit, const FHitResult& Hit,
+                                                             const FLinearColor& SweepColor, const FLinearColor& HitColor,
+                                                             const float Duration)
+{
+	auto& Trace{Add(EAlsDebugTraceType::SweepSingleCapsuleAlternative, Start, End, bHit, &Hit, SweepColor, HitColor, Duration)};
+	Trace.Radius = Radius;
+	Trace.HalfHeight = HalfHeight;
+}
+
+FAlsDebugTrace& FAlsDebugTracesBuffer::Add(const EAlsDebugTraceType Type, const FVector& Start, const FVector& End,
+                                           const bool bHit, const FHitResult* Hit, const FLinearColor& TraceColor,
+                                           const FLinearColor& HitColor, const float Duration)
+{
+	if (Traces.IsEmpty())
+	{
+		Traces.SetNum(Capacity);
+	}
+
+	int32 Index;
+
+	if (Count < Capacity)
+	{
+		Index = (FirstIndex + Count) % Capacity;
+		Count += 1;
+	}
+	else
+	{
+		// The buffer is full, so overwrite the oldest trace.
+
+		Index = FirstIndex;
+		FirstIndex = (FirstIndex + 1) % Capacity;
+	}
+
+	auto& Trace{Traces[Index]};
+
+	Trace.Type = Type;
+	Trace.bHit = bHit && Hit != nullptr && Hit->bBlockingHit;
+	Trace.Start = Start;
+	Trace.End = End;
+	Trace.TraceColor = TraceColor;
+	Trace.HitColor = HitColor;
+	Trace.Duration = Duration;
+
+	if (Trace.bHit)
+	{
+		Trace.HitLocation = Hit->Location;
+		Trace.HitImpactPoint = Hit->ImpactPoint;
+	}
+
+	return Trace;
+}
+
+void FAlsDebugTracesBuffer::Flush(const UObject* WorldContext)
+{
+	check(IsInGameThread())
+
+	FHitResult Hit;
+	Hit.bBlockingHit = true;
+
+	for (auto i{0}; i < Count; i++)
+	{
+		const auto& Trace{Traces[(FirstIndex + i) % Capacity]};
+
+		Hit.Location = Trace.HitLocation;
+		Hit.ImpactPoint = Trace.HitImpactPoint;
+
+		switch (Trace.Type)
+		{
+			case EAlsDebugTraceType::LineTraceSingle:
+				UAlsDebugUtility::DrawLineTraceSingle(WorldContext, Trace.Start, Trace.End, Trace.bHit, Hit,
+				                                      Trace.TraceColor, Trace.HitColor, Trace.Duration);
+				break;
+
+			case EAlsDebugTraceType::SweepSphere:
+				UAlsDebugUtility::DrawSweepSphere(WorldContext, Trace.Start, Trace.End, Trace.Radius,
+				                                  Trace.TraceColor, Trace.Duration);
+				break;
+
+			case EAlsDebugTraceType::SweepSingleSphere:
+				UAlsDebugUtility::DrawSweepSingleSphere(WorldContext, Trace.Start, Trace.End, Trace.Radius, Trace.bHit, Hit,
+				                                        Trace.TraceColor, Trace.HitColor, Trace.Duration);
+				break;
+
+			case EAlsDebugTraceType::SweepSingleCapsule:
+				UAlsDebugUtility::DrawSweepSingleCapsule(WorldContext, Trace.Start, Trace.End, Trace.Rotation, Trace.Radius,
+				                                         Trace.HalfHeight, Trace.bHit, Hit, Trace.TraceColor, Trace.HitColor,
+				                                         Trace.Duration);
+				break;
+
+			case EAlsDebugTraceType::SweepSingleCapsuleAlternative:
+				UAlsDebugUtility::DrawSweepSingleCapsuleAlternative(WorldContext, Trace.Start, Trace.End, Trace.Radius,
+				                                                    Trace.HalfHeight, Trace.bHit, Hit, Trace.TraceColor,
+				                                                    Trace.HitColor, Trace.Duration);
+				break;
+		}
+	}
+
+	Reset();
+}
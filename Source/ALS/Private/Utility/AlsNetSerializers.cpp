@@ -0,0 +1,345 @@
+#include "Utility/AlsNetSerializers.h"
+
+#if UE_WITH_IRIS
+#include "Iris/ReplicationState/PropertyNetSerializerInfoRegistry.h"
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializerDelegates.h"
+#include "Settings/AlsRollingSettings.h"
+#include "Settings/AlsViewSettings.h"
+#endif
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsNetSerializers)
+
+#if UE_WITH_IRIS
+namespace UE::Net
+{
+	struct FAlsRollingParametersNetSerializer
+	{
+		static constexpr uint32 Version{0};
+
+		struct FQuantizedType
+		{
+			uint16 PlayRate;
+			uint16 InitialYawAngle;
+			uint16 TargetYawAngle;
+		};
+
+		using SourceType = FAlsRollingParameters;
+		using QuantizedType = FQuantizedType;
+		using ConfigType = FAlsRollingParametersNetSerializerConfig;
+
+		static const ConfigType DefaultConfig;
+
+		static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args);
+
+		static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args);
+
+		static void Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args);
+
+		static void Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args);
+
+		static bool IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args);
+
+		static bool Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args);
+
+	private:
+		class FNetSerializerRegistryDelegates final : private UE::Net::FNetSerializerRegistryDelegates
+		{
+		public:
+			virtual ~FNetSerializerRegistryDelegates() override;
+
+		private:
+			virtual void OnPreFreezeNetSerializerRegistry() override;
+		};
+
+		static FNetSerializerRegistryDelegates NetSerializerRegistryDelegates;
+	};
+
+	UE_NET_IMPLEMENT_SERIALIZER(FAlsRollingParametersNetSerializer);
+
+	const FAlsRollingParametersNetSerializer::ConfigType FAlsRollingParametersNetSerializer::DefaultConfig;
+
+	FAlsRollingParametersNetSerializer::FNetSerializerRegistryDelegates FAlsRollingParametersNetSerializer::NetSerializerRegistryDelegates;
+
+	static const FName PropertyNetSerializerRegistry_NAME_AlsRollingParameters{TEXTVIEW("AlsRollingParameters")};
+
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AlsRollingParameters,
+	                                                 FAlsRollingParametersNetSerializer);
+
+	void FAlsRollingParametersNetSerializer::Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args)
+	{
+		const auto& Value{*reinterpret_cast<const QuantizedType*>(Args.Source)};
+		auto* Writer{Context.GetBitStreamWriter()};
+
+		Writer->WriteBits(Value.PlayRate, 16);
+		Writer->WriteBits(Value.InitialYawAngle, 16);
+		Writer->WriteBits(Value.TargetYawAngle, 16);
+	}
+
+	void FAlsRollingParametersNetSerializer::Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args)
+	{
+		auto& Value{*reinterpret_cast<QuantizedType*>(Args.Target)};
+		auto* Reader{Context.GetBitStreamReader()};
+
+		Value.PlayRate = static_cast<uint16>(Reader->ReadBits(16));
+		Value.InitialYawAngle = static_cast<uint16>(Reader->ReadBits(16));
+		Value.TargetYawAngle = static_cast<uint16>(Reader->ReadBits(16));
+	}
+
+	void FAlsRollingParametersNetSerializer::Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args)
+	{
+		const auto& Source{*reinterpret_cast<const SourceType*>(Args.Source)};
+		auto& Target{*reinterpret_cast<QuantizedType*>(Args.Target)};
+
+		Target.PlayRate = SourceType::QuantizePlayRate(Source.PlayRate);
+		Target.InitialYawAngle = SourceType::QuantizeYawAngle(Source.InitialYawAngle);
+		Target.TargetYawAngle = SourceType::QuantizeYawAngle(Source.TargetYawAngle);
+	}
+
+	void FAlsRollingParametersNetSerializer::Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args)
+	{
+		const auto& Source{*reinterpret_cast<const QuantizedType*>(Args.Source)};
+		auto& Target{*reinterpret_cast<SourceType*>(Args.Target)};
+
+		Target.PlayRate = SourceType::DequantizePlayRate(Source.PlayRate);
+		Target.InitialYawAngle = SourceType::DequantizeYawAngle(Source.InitialYawAngle);
+		Target.TargetYawAngle = SourceType::DequantizeYawAngle(Source.TargetYawAngle);
+	}
+
+	bool FAlsRollingParametersNetSerializer::IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args)
+	{
+		QuantizedType Value0;
+		QuantizedType Value1;
+
+		if (Args.bStateIsQuantized)
+		{
+			Value0 = *reinterpret_cast<const QuantizedType*>(Args.Source0);
+			Value1 = *reinterpret_cast<const QuantizedType*>(Args.Source1);
+		}
+		else
+		{
+			// Compare the quantized values, since changes smaller than the quantization step are not visible on remote sides.
+
+			FNetQuantizeArgs QuantizeArgs{};
+
+			QuantizeArgs.Source = Args.Source0;
+			QuantizeArgs.Target = NetSerializerValuePointer(&Value0);
+			Quantize(Context, QuantizeArgs);
+
+			QuantizeArgs.Source = Args.Source1;
+			QuantizeArgs.Target = NetSerializerValuePointer(&Value1);
+			Quantize(Context, QuantizeArgs);
+		}
+
+		return Value0.PlayRate == Value1.PlayRate &&
+		       Value0.InitialYawAngle == Value1.InitialYawAngle &&
+		       Value0.TargetYawAngle == Value1.TargetYawAngle;
+	}
+
+	bool FAlsRollingParametersNetSerializer::Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args)
+	{
+		const auto& Source{*reinterpret_cast<const SourceType*>(Args.Source)};
+
+		return FMath::IsFinite(Source.PlayRate) && Source.PlayRate >= 0.0f &&
+		       FMath::IsFinite(Source.InitialYawAngle) && FMath::IsFinite(Source.TargetYawAngle);
+	}
+
+	FAlsRollingParametersNetSerializer::FNetSerializerRegistryDelegates::~FNetSerializerRegistryDelegates()
+	{
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AlsRollingParameters);
+	}
+
+	void FAlsRollingParametersNetSerializer::FNetSerializerRegistryDelegates::OnPreFreezeNetSerializerRegistry()
+	{
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AlsRollingParameters);
+	}
+
+	struct FAlsReplicatedViewRotationNetSerializer
+	{
+		static constexpr uint32 Version{0};
+
+		static constexpr uint32 AxisBitsCountBitsCount{5};
+
+		struct FQuantizedType
+		{
+			uint16 Pitch;
+			uint16 Yaw;
+			uint16 Roll;
+			uint8 AxisBitsCount;
+		};
+
+		using SourceType = FAlsReplicatedViewRotation;
+		using QuantizedType = FQuantizedType;
+		using ConfigType = FAlsReplicatedViewRotationNetSerializerConfig;
+
+		static const ConfigType DefaultConfig;
+
+		static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args);
+
+		static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args);
+
+		static void Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args);
+
+		static void Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args);
+
+		static bool IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args);
+
+		static bool Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args);
+
+	private:
+		class FNetSerializerRegistryDelegates final : private UE::Net::FNetSerializerRegistryDelegates
+		{
+		public:
+			virtual ~FNetSerializerRegistryDelegates() override;
+
+		private:
+			virtual void OnPreFreezeNetSerializerRegistry() override;
+		};
+
+		static FNetSerializerRegistryDelegates NetSerializerRegistryDelegates;
+	};
+
+	UE_NET_IMPLEMENT_SERIALIZER(FAlsReplicatedViewRotationNetSerializer);
+
+	const FAlsReplicatedViewRotationNetSerializer::ConfigType FAlsReplicatedViewRotationNetSerializer::DefaultConfig;
+
+	FAlsReplicatedViewRotationNetSerializer::FNetSerializerRegistryDelegates
+	FAlsReplicatedViewRotationNetSerializer::NetSerializerRegistryDelegates;
+
+	static const FName PropertyNetSerializerRegistry_NAME_AlsReplicatedViewRotation{TEXTVIEW("AlsReplicatedViewRotation")};
+
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AlsReplicatedViewRotation,
+	                                                 FAlsReplicatedViewRotationNetSerializer);
+
+	void FAlsReplicatedViewRotationNetSerializer::Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args)
+	{
+		const auto& Value{*reinterpret_cast<const QuantizedType*>(Args.Source)};
+		auto* Writer{Context.GetBitStreamWriter()};
+
+		Writer->WriteBits(Value.AxisBitsCount, AxisBitsCountBitsCount);
+
+		if (Value.AxisBitsCount == 0)
+		{
+			Writer->WriteBits(Value.Pitch, 16);
+			Writer->WriteBits(Value.Yaw, 16);
+			Writer->WriteBits(Value.Roll, 16);
+		}
+		else
+		{
+			Writer->WriteBits(Value.Pitch, Value.AxisBitsCount);
+			Writer->WriteBits(Value.Yaw, Value.AxisBitsCount);
+		}
+	}
+
+	void FAlsReplicatedViewRotationNetSerializer::Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args)
+	{
+		auto& Value{*reinterpret_cast<QuantizedType*>(Args.Target)};
+		auto* Reader{Context.GetBitStreamReader()};
+
+		Value.AxisBitsCount = static_cast<uint8>(FMath::Min(Reader->ReadBits(AxisBitsCountBitsCount),
+		                                                    static_cast<uint32>(SourceType::MaxAxisBitsCount)));
+
+		if (Value.AxisBitsCount == 0)
+		{
+			Value.Pitch = static_cast<uint16>(Reader->ReadBits(16));
+			Value.Yaw = static_cast<uint16>(Reader->ReadBits(16));
+			Value.Roll = static_cast<uint16>(Reader->ReadBits(16));
+		}
+		else
+		{
+			Value.Pitch = static_cast<uint16>(Reader->ReadBits(Value.AxisBitsCount));
+			Value.Yaw = static_cast<uint16>(Reader->ReadBits(Value.AxisBitsCount));
+			Value.Roll = 0;
+		}
+	}
+
+	void FAlsReplicatedViewRotationNetSerializer::Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args)
+	{
+		const auto& Source{*reinterpret_cast<const SourceType*>(Args.Source)};
+		auto& Target{*reinterpret_cast<QuantizedType*>(Args.Target)};
+
+		Target.AxisBitsCount = FMath::Min(Source.AxisBitsCount, static_cast<uint8>(SourceType::MaxAxisBitsCount));
+
+		if (Target.AxisBitsCount == 0)
+		{
+			// Same as FRotator::NetSerialize().
+
+			Target.Pitch = FRotator::CompressAxisToShort(Source.Rotation.Pitch);
+			Target.Yaw = FRotator::CompressAxisToShort(Source.Rotation.Yaw);
+			Target.Roll = FRotator::CompressAxisToShort(Source.Rotation.Roll);
+		}
+		else
+		{
+			Target.Pitch = static_cast<uint16>(SourceType::QuantizeAxis(Source.Rotation.Pitch, Target.AxisBitsCount));
+			Target.Yaw = static_cast<uint16>(SourceType::QuantizeAxis(Source.Rotation.Yaw, Target.AxisBitsCount));
+			Target.Roll = 0;
+		}
+	}
+
+	void FAlsReplicatedViewRotationNetSerializer::Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args)
+	{
+		const auto& Source{*reinterpret_cast<const QuantizedType*>(Args.Source)};
+		auto& Target{*reinterpret_cast<SourceType*>(Args.Target)};
+
+		Target.AxisBitsCount = Source.AxisBitsCount;
+
+		if (Source.AxisBitsCount == 0)
+		{
+			Target.Rotation.Pitch = FRotator::DecompressAxisFromShort(Source.Pitch);
+			Target.Rotation.Yaw = FRotator::DecompressAxisFromShort(Source.Yaw);
+			Target.Rotation.Roll = FRotator::DecompressAxisFromShort(Source.Roll);
+		}
+		else
+		{
+			Target.Rotation.Pitch = SourceType::DequantizeAxis(Source.Pitch, Source.AxisBitsCount);
+			Target.Rotation.Yaw = SourceType::DequantizeAxis(Source.Yaw, Source.AxisBitsCount);
+			Target.Rotation.Roll = 0.0f;
+		}
+	}
+
+	bool FAlsReplicatedViewRotationNetSerializer::IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args)
+	{
+		QuantizedType Value0;
+		QuantizedType Value1;
+
+		if (Args.bStateIsQuantized)
+		{
+			Value0 = *reinterpret_cast<const QuantizedType*>(Args.Source0);
+			Value1 = *reinterpret_cast<const QuantizedType*>(Args.Source1);
+		}
+		else
+		{
+			FNetQuantizeArgs QuantizeArgs{};
+
+			QuantizeArgs.Source = Args.Source0;
+			QuantizeArgs.Target = NetSerializerValuePointer(&Value0);
+			Quantize(Context, QuantizeArgs);
+
+			QuantizeArgs.Source = Args.Source1;
+			QuantizeArgs.Target = NetSerializerValuePointer(&Value1);
+			Quantize(Context, QuantizeArgs);
+		}
+
+		return Value0.AxisBitsCount == Value1.AxisBitsCount && Value0.Pitch == Value1.Pitch &&
+		       Value0.Yaw == Value1.Yaw && Value0.Roll == Value1.Roll;
+	}
+
+	bool FAlsReplicatedViewRotationNetSerializer::Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args)
+	{
+		const auto& Source{*reinterpret_cast<const SourceType*>(Args.Source)};
+
+		return Source.AxisBitsCount <= SourceType::MaxAxisBitsCount && !Source.Rotation.ContainsNaN();
+	}
+
+	FAlsReplicatedViewRotationNetSerializer::FNetSerializerRegistryDelegates::~FNetSerializerRegistryDelegates()
+	{
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AlsReplicatedViewRotation);
+	}
+
+	void FAlsReplicatedViewRotationNetSerializer::FNetSerializerRegistryDelegates::OnPreFreezeNetSerializerRegistry()
+	{
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AlsReplicatedViewRotation);
+	}
+}
+#endif
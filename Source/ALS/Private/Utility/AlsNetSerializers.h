@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Iris/Serialization/NetSerializer.h"
+#include "AlsNetSerializers.generated.h"
+
+// Native Iris serializers for ALS types. They quantize values exactly like the NetSerialize() functions
+// of the corresponding types, so both replication systems produce identical results on remote sides.
+
+USTRUCT()
+struct FAlsRollingParametersNetSerializerConfig : public FNetSerializerConfig
+{
+	GENERATED_BODY()
+};
+
+USTRUCT()
+struct FAlsReplicatedViewRotationNetSerializerConfig : public FNetSerializerConfig
+{
+	GENERATED_BODY()
+};
+
+namespace UE::Net
+{
+	UE_NET_DECLARE_SERIALIZER(FAlsRollingParametersNetSerializer, ALS_API);
+
+	UE_NET_DECLARE_SERIALIZER(FAlsReplicatedViewRotationNetSerializer, ALS_API);
+}
@@ -6,6 +6,8 @@
 #include "Engine/World.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/PlayerState.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
 #include "Utility/AlsMacros.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsUtility)
@@ -72,3 +74,17 @@ bool UAlsUtility::TryGetMovementBaseRotationSpeed(const FBasedMovementInfo& Base
 
 	return true;
 }
+
+FVector UAlsUtility::RoundTripNetQuantize(const FVector& Location)
+{
+	FVector_NetQuantize Quantized{Location};
+	auto bSuccess{true};
+
+	FBitWriter Writer{0, true};
+	Quantized.NetSerialize(Writer, nullptr, bSuccess);
+
+	FBitReader Reader{Writer.GetData(), Writer.GetNumBits()};
+	Quantized.NetSerialize(Reader, nullptr, bSuccess);
+
+	return ALS_ENSURE(bSuccess && !Reader.IsError()) ? FVector{Quantized} : Location;
+}
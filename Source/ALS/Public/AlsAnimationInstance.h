@@ -11,6 +11,7 @@
 #include "State/AlsLayeringState.h"
 #include "State/AlsLeanState.h"
 #include "State/AlsLocomotionAnimationState.h"
+#include "State/AlsLodLevel.h"
 #include "State/AlsLookState.h"
 #include "State/AlsMovementBaseState.h"
 #include "State/AlsPoseState.h"
@@ -21,6 +22,9 @@
 #include "State/AlsTransitionsState.h"
 #include "State/AlsTurnInPlaceState.h"
 #include "State/AlsViewAnimationState.h"
+#include "Utility/AlsBoneTransformsCache.h"
+#include "Utility/AlsCurvesCache.h"
+#include "Utility/AlsDebugTracesBuffer.h"
 #include "Utility/AlsGameplayTags.h"
 #include "AlsAnimationInstance.generated.h"
 
@@ -51,11 +55,16 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ClampMin = 0))
 	double TeleportedTime{0.0f};
 
+	// Cached locations of the layering and pose curves, rebuilt when the skeleton changes.
+	FAlsCurvesCache CurvesCache;
+
+	FAlsBoneTransformsCache FeetTargetTransformsCache;
+
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bDisplayDebugTraces : 1 {false};
 
-	mutable TArray<TFunction<void()>> DisplayDebugTracesQueue;
+	mutable FAlsDebugTracesBuffer DisplayDebugTracesBuffer;
 #endif
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
@@ -82,6 +91,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FGameplayTag GroundedEntryMode;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	EAlsLodLevel LodLevel{EAlsLodLevel::Full};
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsMovementBaseState MovementBase;
 
@@ -165,6 +177,8 @@ public:
 	void MarkTeleported();
 
 private:
+	void RefreshCurvesCacheOnGameThread();
+
 	void RefreshMovementBaseOnGameThread();
 
 	void RefreshLayering();
@@ -267,6 +281,17 @@ protected:
 
 	void RefreshGroundPrediction();
 
+	bool TryExtrapolateGroundPrediction(const FVector& SweepDirection, float SweepDistance, float& SweepTime, bool& bGroundValid) const;
+
+public:
+	// Finds the time to impact of a ground prediction sweep by projecting the impact location of a previous
+	// sweep onto it. Returns false if that impact location is no longer along the sweep.
+	static bool TryExtrapolateGroundPredictionSweepTime(const FVector& SweepStartLocation, const FVector& SweepDirection,
+	                                                    float SweepDistance, float CapsuleRadius,
+	                                                    const FVector& PreviousImpactLocation, float& SweepTime);
+
+protected:
+
 	void RefreshInAirLean();
 
 	// Feet
@@ -281,9 +306,9 @@ private:
 
 	void RefreshFeet(float DeltaTime);
 
-	void RefreshFoot(FAlsFootState& FootState, const FName& IkCurveName, const FName& LockCurveName,
-	                 const FAlsFootConstraintsSettings& ConstraintsSettings, const FTransform& ComponentTransformInverse,
-	                 float DeltaTime) const;
+	void RefreshFoot(FAlsFootState& FootState, FAlsFootOffsetTraceState& OffsetTraceState, const FName& IkCurveName,
+	                 const FName& LockCurveName, const FAlsFootConstraintsSettings& ConstraintsSettings,
+	                 const FTransform& ComponentTransformInverse, float DeltaTime) const;
 
 	void ProcessFootLockTeleport(FAlsFootState& FootState) const;
 
@@ -292,7 +317,14 @@ private:
 	void RefreshFootLock(FAlsFootState& FootState, const FName& LockCurveName, const FTransform& ComponentTransformInverse,
 	                     float DeltaTime, FVector& FinalLocation, FQuat& FinalRotation) const;
 
-	void RefreshFootOffset(FAlsFootState& FootState, float DeltaTime, FVector& FinalLocation, FQuat& FinalRotation) const;
+	void RefreshFootOffset(FAlsFootState& FootState, FAlsFootOffsetTraceState& OffsetTraceState, float DeltaTime,
+	                       FVector& FinalLocation, FQuat& FinalRotation) const;
+
+	void RequestFootOffsetTraceOnGameThread(FAlsFootOffsetTraceState& OffsetTraceState) const;
+
+	void ReceiveFootOffsetTraceOnGameThread(FAlsFootOffsetTraceState& OffsetTraceState) const;
+
+	bool TryGetAsyncFootOffsetHit(const FAlsFootOffsetTraceState& OffsetTraceState, FHitResult& Hit) const;
 
 	void ConstraintFootRotation(const FAlsFootConstraintsSettings& ConstraintsSettings, const FQuat& ParentRotation, FQuat& Rotation) const;
 
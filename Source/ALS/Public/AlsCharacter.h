@@ -1,16 +1,20 @@
 #pragma once
 
 #include "GameFramework/Character.h"
+#include "Settings/AlsViewSettings.h"
 #include "State/AlsLocomotionState.h"
+#include "State/AlsLodLevel.h"
 #include "State/AlsMantlingState.h"
 #include "State/AlsMovementBaseState.h"
 #include "State/AlsRagdollingState.h"
 #include "State/AlsRollingState.h"
 #include "State/AlsViewState.h"
+#include "Utility/AlsDebugTracesBuffer.h"
 #include "Utility/AlsGameplayTags.h"
 #include "AlsCharacter.generated.h"
 
 struct FAlsMantlingParameters;
+struct FAlsRollingParameters;
 struct FAlsMantlingTraceSettings;
 class UAlsCharacterMovementComponent;
 class UAlsCharacterSettings;
@@ -78,7 +82,12 @@ protected:
 	// base space. In most cases, it is better to use FAlsViewState::Rotation to take advantage of network smoothing.
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient,
 		ReplicatedUsing = "OnReplicated_ReplicatedViewRotation")
-	FRotator ReplicatedViewRotation{ForceInit};
+	FAlsReplicatedViewRotation ReplicatedViewRotation;
+
+	// Same as the replicated view rotation, but neither quantized nor delta thresholded on
+	// the sides that set it. Used instead of the replicated view rotation on those sides.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
+	FRotator LocalViewRotation{ForceInit};
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsViewState ViewState;
@@ -105,8 +114,25 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsRollingState RollingState;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
+	EAlsLodLevel LodLevel{EAlsLodLevel::Full};
+
+	// Assigned by the server based on the distance to the viewers of other connections.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient,
+		ReplicatedUsing = "OnReplicated_NetworkLodLevel")
+	EAlsLodLevel NetworkLodLevel{EAlsLodLevel::Full};
+
+	// Network update frequency at the full network LOD level, scaled down at lower levels. Captured in BeginPlay(),
+	// so later changes must be made with SetBaseNetUpdateFrequency() rather than directly to NetUpdateFrequency.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient, Meta = (ClampMin = 0))
+	float BaseNetUpdateFrequency{0.0f};
+
 	FTimerHandle BrakingFrictionFactorResetTimer;
 
+#if ENABLE_DRAW_DEBUG
+	FAlsDebugTracesBuffer DisplayDebugTracesBuffer;
+#endif
+
 public:
 	explicit AAlsCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
@@ -125,6 +151,8 @@ public:
 protected:
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void CalcCamera(float DeltaTime, FMinimalViewInfo& ViewInfo) override;
 
 public:
@@ -147,6 +175,35 @@ private:
 
 	void RefreshMovementBase();
 
+	// Significance
+
+public:
+	const UAlsCharacterSettings* GetSettings() const;
+
+	EAlsLodLevel GetLodLevel() const;
+
+	void SetLodLevel(EAlsLodLevel NewLodLevel);
+
+	EAlsLodLevel GetNetworkLodLevel() const;
+
+	void SetNetworkLodLevel(EAlsLodLevel NewNetworkLodLevel);
+
+	float GetBaseNetUpdateFrequency() const;
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character")
+	void SetBaseNetUpdateFrequency(float NewBaseNetUpdateFrequency);
+
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+
+	virtual float GetNetPriority(const FVector& ViewLocation, const FVector& ViewDirection, AActor* Viewer, AActor* ViewTarget,
+	                             UActorChannel* Channel, float Time, bool bLowBandwidth) override;
+
+private:
+	void RefreshNetUpdateFrequency();
+
+	UFUNCTION()
+	void OnReplicated_NetworkLodLevel();
+
 	// View Mode
 
 public:
@@ -367,7 +424,7 @@ private:
 	void SetReplicatedViewRotation(const FRotator& NewViewRotation, bool bSendRpc);
 
 	UFUNCTION(Server, Unreliable)
-	void ServerSetReplicatedViewRotation(const FRotator& NewViewRotation);
+	void ServerSetReplicatedViewRotation(const FAlsReplicatedViewRotation& NewViewRotation);
 
 	UFUNCTION()
 	void OnReplicated_ReplicatedViewRotation();
@@ -472,12 +529,12 @@ private:
 	void StartRolling(float PlayRate, float TargetYawAngle);
 
 	UFUNCTION(Server, Reliable)
-	void ServerStartRolling(UAnimMontage* Montage, float PlayRate, float InitialYawAngle, float TargetYawAngle);
+	void ServerStartRolling(UAnimMontage* Montage, const FAlsRollingParameters& Parameters);
 
 	UFUNCTION(NetMulticast, Reliable)
-	void MulticastStartRolling(UAnimMontage* Montage, float PlayRate, float InitialYawAngle, float TargetYawAngle);
+	void MulticastStartRolling(UAnimMontage* Montage, const FAlsRollingParameters& Parameters);
 
-	void StartRollingImplementation(UAnimMontage* Montage, float PlayRate, float InitialYawAngle, float TargetYawAngle);
+	void StartRollingImplementation(UAnimMontage* Montage, const FAlsRollingParameters& Parameters);
 
 	void RefreshRolling(float DeltaTime);
 
@@ -497,6 +554,10 @@ private:
 
 	bool StartMantling(const FAlsMantlingTraceSettings& TraceSettings);
 
+	bool IsInAirMantlingTraceRejected(const FIntVector& LocationCell, int32 DirectionSector) const;
+
+	void RejectInAirMantlingTrace(const FIntVector& LocationCell, int32 DirectionSector);
+
 	UFUNCTION(Server, Reliable)
 	void ServerStartMantling(const FAlsMantlingParameters& Parameters);
 
@@ -554,12 +615,12 @@ public:
 
 private:
 	UFUNCTION(Server, Reliable)
-	void ServerStopRagdolling();
+	void ServerStopRagdolling(const FVector_NetQuantize& FinalTargetLocation);
 
 	UFUNCTION(NetMulticast, Reliable)
-	void MulticastStopRagdolling();
+	void MulticastStopRagdolling(const FVector_NetQuantize& FinalTargetLocation);
 
-	void StopRagdollingImplementation();
+	void StopRagdollingImplementation(const FVector& FinalTargetLocation);
 
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "Als Character")
@@ -600,6 +661,31 @@ private:
 	void DisplayDebugMantling(const UCanvas* Canvas, float Scale, float HorizontalLocation, float& VerticalLocation) const;
 };
 
+inline const UAlsCharacterSettings* AAlsCharacter::GetSettings() const
+{
+	return Settings;
+}
+
+inline EAlsLodLevel AAlsCharacter::GetLodLevel() const
+{
+	return LodLevel;
+}
+
+inline void AAlsCharacter::SetLodLevel(const EAlsLodLevel NewLodLevel)
+{
+	LodLevel = NewLodLevel;
+}
+
+inline EAlsLodLevel AAlsCharacter::GetNetworkLodLevel() const
+{
+	return NetworkLodLevel;
+}
+
+inline float AAlsCharacter::GetBaseNetUpdateFrequency() const
+{
+	return BaseNetUpdateFrequency;
+}
+
 inline const FGameplayTag& AAlsCharacter::GetViewMode() const
 {
 	return ViewMode;
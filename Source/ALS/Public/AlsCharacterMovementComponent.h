@@ -185,6 +185,8 @@ public:
 
 	const FAlsMovementGaitSettings& GetGaitSettings() const;
 
+	const FAlsMovementBakedGaitCurves* GetBakedGaitCurves() const;
+
 private:
 	void RefreshGaitSettings();
 
@@ -219,6 +221,11 @@ inline const FAlsMovementGaitSettings& UAlsCharacterMovementComponent::GetGaitSe
 	return GaitSettings;
 }
 
+inline const FAlsMovementBakedGaitCurves* UAlsCharacterMovementComponent::GetBakedGaitCurves() const
+{
+	return IsValid(MovementSettings) ? MovementSettings->FindBakedGaitCurves(GaitSettings.TableIndex) : nullptr;
+}
+
 inline const FGameplayTag& UAlsCharacterMovementComponent::GetRotationMode() const
 {
 	return RotationMode;
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "State/AlsLodLevel.h"
+#include "AlsSignificanceSubsystem.generated.h"
+
+struct FAlsLodSettings;
+class AAlsCharacter;
+class APlayerController;
+
+// Periodically scores registered characters by their distance to local viewers, rendering, and local
+// control, and assigns them LOD levels that reduce the amount of work done by less significant characters.
+// On the server, it also assigns network LOD levels based on the distance to the viewers of other connections.
+UCLASS()
+class ALS_API UAlsSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	TArray<TWeakObjectPtr<AAlsCharacter>> Characters;
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient, Meta = (ForceUnits = "s"))
+	float RefreshTimeRemaining{0.0f};
+
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+
+	// Only filled on the server. Players are only used to skip the characters' own viewers.
+
+	TArray<FVector, TInlineAllocator<16>> NetworkViewLocations;
+
+	TArray<const APlayerController*, TInlineAllocator<16>> NetworkViewPlayers;
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+public:
+	virtual TStatId GetStatId() const override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	void RegisterCharacter(AAlsCharacter* Character);
+
+	void UnregisterCharacter(AAlsCharacter* Character);
+
+	static EAlsLodLevel CalculateLodLevel(const FAlsLodSettings& LodSettings, float ViewDistanceSquared,
+	                                      bool bLocallyControlled, bool bRecentlyRendered);
+
+	static EAlsLodLevel CalculateNetworkLodLevel(const FAlsLodSettings& LodSettings, float ViewDistanceSquared);
+
+private:
+	void RefreshViewLocations();
+
+	void RefreshCharacterLodLevel(AAlsCharacter& Character) const;
+
+	void RefreshCharacterNetworkLodLevel(AAlsCharacter& Character) const;
+};
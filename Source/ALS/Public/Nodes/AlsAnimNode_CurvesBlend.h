@@ -3,6 +3,8 @@
 #include "Animation/AnimNodeBase.h"
 #include "AlsAnimNode_CurvesBlend.generated.h"
 
+class UAnimSequenceBase;
+
 UENUM(BlueprintType)
 enum class EAlsCurvesBlendMode : uint8
 {
@@ -38,6 +40,18 @@ public:
 
 	UPROPERTY(EditAnywhere, Category = "Settings", Meta = (FoldProperty))
 	EAlsCurvesBlendMode BlendMode{EAlsCurvesBlendMode::BlendByAmount};
+
+	// Static sequence mode. If set, the curves pose is ignored entirely, it is neither updated nor evaluated, and
+	// the curves are taken from a single frame of this animation instead. Any blending or state logic connected to
+	// the curves pose is not applied in this mode, so it only suits curves that do not depend on the animation state.
+	// A pose link cannot be evaluated for curves alone, so this is the only way to skip the bone evaluation of the
+	// curves pose.
+	UPROPERTY(EditAnywhere, Category = "Settings", Meta = (FoldProperty))
+	TObjectPtr<UAnimSequenceBase> StaticCurvesSequence;
+
+	// The time of the static curves sequence frame to take the curves from.
+	UPROPERTY(EditAnywhere, Category = "Settings", Meta = (ClampMin = 0, FoldProperty, ForceUnits = "s"))
+	float StaticCurvesSequenceTime{0.0f};
 #endif
 
 public:
@@ -55,4 +69,15 @@ public:
 	float GetBlendAmount() const;
 
 	EAlsCurvesBlendMode GetBlendMode() const;
+
+	UAnimSequenceBase* GetStaticCurvesSequence() const;
+
+	float GetStaticCurvesSequenceTime() const;
+
+public:
+	static void BlendCurves(FBlendedCurve& Curve, const FBlendedCurve& CurvesToBlend, float Amount, EAlsCurvesBlendMode Mode);
+
+	// Blends the curves of a single frame of the sequence the same way as the static sequence mode does.
+	static void BlendStaticCurves(FBlendedCurve& Curve, const UAnimSequenceBase& Sequence,
+	                              float SequenceTime, float Amount, EAlsCurvesBlendMode Mode);
 };
@@ -18,12 +18,28 @@ public:
 	TArray<FGameplayTag> Tags;
 #endif
 
+protected:
+	// Maps tags to child indices, so the active child can be found without scanning the tags array.
+	TMap<FGameplayTag, int32> ChildIndices;
+
+	// Copy of the tags the child indices were built from, used to detect tags changed through a pin.
+	TArray<FGameplayTag> ChildIndicesTags;
+
+	FGameplayTag PreviousActiveTag;
+
+	int32 PreviousActiveChildIndex{0};
+
 public:
 	virtual ~FAlsAnimNode_GameplayTagsBlend() override = default; // Required by Clang.
 
+	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
+
 protected:
 	virtual int32 GetActiveChildIndex() override;
 
+private:
+	void RefreshChildIndices();
+
 public:
 	const FGameplayTag& GetActiveTag() const;
 
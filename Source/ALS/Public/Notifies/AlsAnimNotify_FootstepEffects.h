@@ -7,6 +7,7 @@
 
 enum EPhysicalSurface : int;
 struct FHitResult;
+struct FStreamableHandle;
 class USoundBase;
 class UMaterialInterface;
 class UNiagaraSystem;
@@ -190,10 +191,22 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ForceInlineRow))
 	TMap<TEnumAsByte<EPhysicalSurface>, FAlsFootstepEffectSettings> Effects;
 
+private:
+	// Keeps the asynchronously loaded effect assets resident for as long as this settings asset is alive.
+	TSharedPtr<FStreamableHandle> EffectsLoadHandle;
+
 public:
+	virtual void PostLoad() override;
+
+	virtual void BeginDestroy() override;
+
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent) override;
 #endif
+
+	// Starts loading all sounds, decal materials, and particle systems referenced by the effects, if not already
+	// started. Footstep effects never load assets synchronously, so effects whose assets are not yet loaded are skipped.
+	void LoadEffectsAsync();
 };
 
 UCLASS(DisplayName = "Als Footstep Effects Animation Notify",
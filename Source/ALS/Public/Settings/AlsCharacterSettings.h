@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "AlsInAirRotationMode.h"
+#include "AlsLodSettings.h"
 #include "AlsMantlingSettings.h"
 #include "AlsRagdollingSettings.h"
 #include "AlsRollingSettings.h"
@@ -49,6 +50,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsRollingSettings Rolling;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsLodSettings Lod;
+
 public:
 	UAlsCharacterSettings();
 
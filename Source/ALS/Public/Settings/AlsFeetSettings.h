@@ -65,6 +65,16 @@ struct ALS_API FAlsFeetSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
 	float IkTraceDistanceDownward{45.0f};
 
+	// If checked, foot IK traces are performed asynchronously and the results of the previous frame's traces are used.
+	// This noticeably reduces the cost of foot IK with a large number of characters, at the cost of a one frame delay.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bUseAsyncIkTraces : 1 {false};
+
+	// Async foot IK trace results older than this are discarded and a synchronous trace is performed instead.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, ForceUnits = "s", EditCondition = "bUseAsyncIkTraces"))
+	float AsyncIkTraceMaxAge{0.1f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FAlsFootConstraintsSettings LeftFootConstraints;
 
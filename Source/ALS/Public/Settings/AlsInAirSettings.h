@@ -28,6 +28,21 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "ALS", AdvancedDisplay)
 	FCollisionResponseContainer GroundPredictionSweepResponses{ECR_Ignore};
 
+	// If checked, the ground prediction sweep is performed at a reduced rate, and in between sweeps the time
+	// to impact is extrapolated from the previous sweep result along the character's current trajectory.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bDecimateGroundPredictionSweep : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bDecimateGroundPredictionSweep", ForceUnits = "s"))
+	float GroundPredictionSweepInterval{0.1f};
+
+	// The ground prediction sweep is performed immediately if the velocity
+	// direction has changed by more than this angle since the previous sweep.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, ClampMax = 180, EditCondition = "bDecimateGroundPredictionSweep", ForceUnits = "deg"))
+	float GroundPredictionSweepMaxAngle{10.0f};
+
 public:
 #if WITH_EDITOR
 	void PostEditChangeProperty(const FPropertyChangedEvent& ChangedEvent);
@@ -0,0 +1,73 @@
+﻿#pragma once
+
+#include "State/AlsLodLevel.h"
+#include "AlsLodSettings.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsLodSettings
+{
+	GENERATED_BODY()
+
+	// If checked, the character will be registered in the significance subsystem, which will reduce
+	// the amount of work done by the character and its animation instance depending on its significance.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bEnableLod : 1 {false};
+
+	// The character will switch to the reduced LOD level if it is farther than the specified distance from all viewers.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bEnableLod", ForceUnits = "cm"))
+	float ReducedLodDistance{1500.0f};
+
+	// The character will switch to the minimal LOD level if it is farther than the specified distance from all viewers.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bEnableLod", ForceUnits = "cm"))
+	float MinimalLodDistance{3500.0f};
+
+	// If checked, characters that have not been rendered recently will be switched to the next LOD level.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bEnableLod"))
+	uint8 bLowerLodWhenNotRendered : 1 {true};
+
+	// If checked, the server will lower the network update frequency and priority of the character depending on
+	// its distance to the viewers of other connections, and stop replicating the view rotation when the character
+	// is far from all of them. Simulated proxies extrapolate the view rotation while it is not replicated.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bEnableNetworkLod : 1 {false};
+
+	// The character will switch to the reduced network LOD level if it is farther than the specified distance from all viewers.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bEnableNetworkLod", ForceUnits = "cm"))
+	float ReducedNetworkLodDistance{2500.0f};
+
+	// The character will switch to the minimal network LOD level if it is farther than the specified distance from all viewers.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bEnableNetworkLod", ForceUnits = "cm"))
+	float MinimalNetworkLodDistance{5000.0f};
+
+	// Network update frequency and priority multiplier used at the reduced network LOD level.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0.01, ClampMax = 1, EditCondition = "bEnableNetworkLod"))
+	float ReducedNetworkLodScale{0.5f};
+
+	// Network update frequency and priority multiplier used at the minimal network LOD level.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0.01, ClampMax = 1, EditCondition = "bEnableNetworkLod"))
+	float MinimalNetworkLodScale{0.25f};
+
+public:
+	float GetNetworkLodScale(EAlsLodLevel NetworkLodLevel) const;
+};
+
+inline float FAlsLodSettings::GetNetworkLodScale(const EAlsLodLevel NetworkLodLevel) const
+{
+	switch (NetworkLodLevel)
+	{
+		case EAlsLodLevel::Reduced:
+			return ReducedNetworkLodScale;
+
+		case EAlsLodLevel::Minimal:
+			return MinimalNetworkLodScale;
+
+		default:
+			return 1.0f;
+	}
+}
@@ -64,6 +64,42 @@ public:
 	// Optional mantling time to vertical correction amount curve.
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	TObjectPtr<UCurveFloat> VerticalCorrectionCurve;
+
+private:
+	// Montage root motion locations sampled at the montage frame rate. Built on first use, since
+	// root motion extraction is too expensive to be performed during mantling every frame. In the
+	// editor, they are rebuilt when the montage or any of its animations is edited or reimported.
+	mutable TArray<FVector> RootMotionLocations;
+
+	mutable float RootMotionSampleInterval{0.0f};
+
+	mutable TWeakObjectPtr<const UAnimMontage> RootMotionMontage;
+
+public:
+#if WITH_EDITOR
+	virtual void PostInitProperties() override;
+
+	virtual void BeginDestroy() override;
+
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent) override;
+#endif
+
+	// Returns the root motion location of the montage at the specified time, interpolated between the sampled locations.
+	FVector GetRootMotionLocation(float Time) const;
+
+	FVector GetLastRootMotionLocation() const;
+
+	// Returns the earliest time at which the vertical root motion location of the montage reaches the specified value.
+	float FindRootMotionTimeByLocationZ(float LocationZ) const;
+
+private:
+#if WITH_EDITOR
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& ChangedEvent);
+#endif
+
+	void ResetRootMotionLocations() const;
+
+	bool RefreshRootMotionLocations() const;
 };
 
 USTRUCT(BlueprintType)
@@ -122,6 +158,20 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FAlsMantlingTraceSettings InAirTrace{{50.0f, 150.0f}, 70.0f};
 
+	// The minimum time between in-air mantling attempts. If zero, mantling will be attempted every frame.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float InAirTraceInterval{0.0f};
+
+	// How long failed in-air mantling attempts are remembered. While remembered, attempts from the same
+	// location in the same direction are rejected without performing any traces. If zero, failed attempts
+	// are not remembered.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float InAirRejectedTraceCacheDuration{0.0f};
+
+	// The size of the grid cells used to compare the locations of failed in-air mantling attempts.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 1, ForceUnits = "cm"))
+	float InAirRejectedTraceCacheCellSize{25.0f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TEnumAsByte<ECollisionChannel> MantlingTraceChannel{ECC_Visibility};
 
@@ -6,6 +6,90 @@
 
 class UCurveFloat;
 class UCurveVector;
+class UPackageMap;
+struct FAlsMovementGaitSettings;
+
+// Small integer indices of the built-in rotation mode, stance, and gait tags. They allow gait
+// settings to be looked up in a dense table instead of hashing gameplay tags on the hot path.
+namespace AlsMovementSettingsIndices
+{
+	inline constexpr auto RotationModesCount{3};
+	inline constexpr auto StancesCount{2};
+	inline constexpr auto GaitsCount{3};
+
+	// Fixed bit widths used to encode the indices in network moves. The largest
+	// value that fits into the bit width is reserved to mark custom tags.
+
+	inline constexpr auto RotationModeIndexBits{2};
+	inline constexpr auto StanceIndexBits{2};
+	inline constexpr auto GaitIndexBits{2};
+
+	static_assert(RotationModesCount < 1 << RotationModeIndexBits);
+	static_assert(StancesCount < 1 << StanceIndexBits);
+	static_assert(GaitsCount < 1 << GaitIndexBits);
+
+	// The built-in tags of each family. The index of a tag is its position in the array,
+	// so these arrays are the only place that defines the order of the indices.
+
+	TConstArrayView<FGameplayTag> GetRotationModes();
+
+	TConstArrayView<FGameplayTag> GetStances();
+
+	TConstArrayView<FGameplayTag> GetGaits();
+
+	// Returns INDEX_NONE for custom rotation modes.
+	int32 GetRotationModeIndex(const FGameplayTag& RotationMode);
+
+	// Returns INDEX_NONE for custom stances.
+	int32 GetStanceIndex(const FGameplayTag& Stance);
+
+	// Returns INDEX_NONE for custom gaits.
+	int32 GetGaitIndex(const FGameplayTag& Gait);
+
+	// Returns an empty tag for invalid indices.
+	FGameplayTag GetRotationModeByIndex(int32 Index);
+
+	// Returns an empty tag for invalid indices.
+	FGameplayTag GetStanceByIndex(int32 Index);
+
+	// Returns an empty tag for invalid indices.
+	FGameplayTag GetGaitByIndex(int32 Index);
+
+	// Serialize a tag as an index of the bit width of its family, or in full if it is a custom tag.
+
+	ALS_API void NetSerializeRotationMode(FArchive& Archive, UPackageMap* Map, FGameplayTag& RotationMode);
+
+	ALS_API void NetSerializeStance(FArchive& Archive, UPackageMap* Map, FGameplayTag& Stance);
+
+	ALS_API void NetSerializeGait(FArchive& Archive, UPackageMap* Map, FGameplayTag& Gait);
+}
+
+// Gait curves baked into lookup tables that are sampled with linear interpolation. Stored in the movement
+// settings rather than in the gait settings, since the gait settings are copied on every gait or stance change.
+struct ALS_API FAlsMovementBakedGaitCurves
+{
+	// Samples are placed every 0.1 gait amount, so that the walking, running,
+	// and sprinting gait amounts fall exactly on the samples.
+	static constexpr auto SamplesCount{31};
+
+	FVector3f AccelerationAndDecelerationAndGroundFriction[SamplesCount]{};
+
+	float RotationInterpolationSpeed[SamplesCount]{};
+
+	uint8 bAccelerationAndDecelerationAndGroundFrictionBaked : 1 {false};
+
+	uint8 bRotationInterpolationSpeedBaked : 1 {false};
+
+public:
+	void Bake(const FAlsMovementGaitSettings& GaitSettings);
+
+	// Returns the maximum difference between the lookup tables and the curves they were baked from.
+	float CalculateMaxError(const FAlsMovementGaitSettings& GaitSettings) const;
+
+	FVector3f SampleAccelerationAndDecelerationAndGroundFriction(float GaitAmount) const;
+
+	float SampleRotationInterpolationSpeed(float GaitAmount) const;
+};
 
 USTRUCT(BlueprintType)
 struct ALS_API FAlsMovementGaitSettings
@@ -32,8 +116,35 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UCurveFloat> RotationInterpolationSpeedCurve;
 
+	// If checked, the curves are baked into lookup tables that are sampled with linear interpolation. This is
+	// cheaper than evaluating the curves, but may be less accurate for curves with sharp changes. Only the
+	// gait settings of the built-in rotation modes and stances are baked, the rest always evaluate the curves.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bUseBakedCurves : 1 {false};
+
+	// The maximum difference between the baked lookup tables and the curves they were baked from.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", Transient, AdvancedDisplay,
+		Meta = (EditCondition = "bUseBakedCurves"))
+	float BakedCurvesMaxError{0.0f};
+
+	// Index of these gait settings in the gait settings table of the movement settings they were taken from.
+	// It only depends on the rotation mode and stance, so it stays valid when the table is rebuilt.
+	int32 TableIndex{INDEX_NONE};
+
 public:
 	float GetSpeedByGait(const FGameplayTag& Gait) const;
+
+	float GetSpeedByGaitIndex(int32 GaitIndex) const;
+
+	// The baked curves are optional, the curves are evaluated if they are not provided.
+
+	float GetAccelerationByGaitAmount(float GaitAmount, const FAlsMovementBakedGaitCurves* BakedCurves) const;
+
+	float GetDecelerationByGaitAmount(float GaitAmount, const FAlsMovementBakedGaitCurves* BakedCurves) const;
+
+	float GetGroundFrictionByGaitAmount(float GaitAmount, const FAlsMovementBakedGaitCurves* BakedCurves) const;
+
+	float GetRotationInterpolationSpeedByGaitAmount(float GaitAmount, const FAlsMovementBakedGaitCurves* BakedCurves) const;
 };
 
 USTRUCT(BlueprintType)
@@ -62,24 +173,165 @@ public:
 		{AlsRotationModeTags::ViewDirection, {}},
 		{AlsRotationModeTags::Aiming, {}}
 	};
+
+protected:
+	// Dense copy of the gait settings for the built-in rotation modes and stances, indexed by
+	// RotationModeIndex * StancesCount + StanceIndex. Unset entries are missing from the map. Built on
+	// first use, so settings created at runtime are covered too. Call RefreshGaitSettingsTable()
+	// after changing the rotation modes map at runtime to keep them in sync.
+	mutable TArray<TOptional<FAlsMovementGaitSettings>, TInlineAllocator<AlsMovementSettingsIndices::RotationModesCount *
+	                                                                      AlsMovementSettingsIndices::StancesCount>> GaitSettingsTable;
+
+	// Baked curves of the gait settings table entries, indexed the same way as the table.
+	mutable TArray<TOptional<FAlsMovementBakedGaitCurves>> BakedGaitCurves;
+
+public:
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostInitProperties() override;
+
+	virtual void BeginDestroy() override;
+
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent) override;
+
+	virtual void PostEditUndo() override;
+#endif
+
+	// Also refreshes the baked curves of all gait settings.
+	void RefreshGaitSettingsTable();
+
+	const FAlsMovementGaitSettings* FindGaitSettings(const FGameplayTag& RotationMode, const FGameplayTag& Stance) const;
+
+	// Returns the baked curves of the table entry at FAlsMovementGaitSettings::TableIndex as they are now, so
+	// copies of the gait settings taken before the table was rebuilt still get the curves of their own entry.
+	const FAlsMovementBakedGaitCurves* FindBakedGaitCurves(int32 TableIndex) const;
+
+private:
+#if WITH_EDITOR
+	bool IsCurveUsed(const UObject* Curve) const;
+
+	void OnObjectModified(UObject* Object);
+
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& ChangedEvent);
+#endif
+
+	void BuildGaitSettingsTable() const;
 };
 
-inline float FAlsMovementGaitSettings::GetSpeedByGait(const FGameplayTag& Gait) const
+namespace AlsMovementSettingsIndices
 {
-	if (Gait == AlsGaitTags::Walking)
+	inline TConstArrayView<FGameplayTag> GetRotationModes()
+	{
+		static const FGameplayTag RotationModes[]
+		{
+			AlsRotationModeTags::VelocityDirection,
+			AlsRotationModeTags::ViewDirection,
+			AlsRotationModeTags::Aiming
+		};
+
+		static_assert(UE_ARRAY_COUNT(RotationModes) == RotationModesCount);
+
+		return RotationModes;
+	}
+
+	inline TConstArrayView<FGameplayTag> GetStances()
+	{
+		static const FGameplayTag Stances[]
+		{
+			AlsStanceTags::Standing,
+			AlsStanceTags::Crouching
+		};
+
+		static_assert(UE_ARRAY_COUNT(Stances) == StancesCount);
+
+		return Stances;
+	}
+
+	inline TConstArrayView<FGameplayTag> GetGaits()
 	{
-		return WalkSpeed;
+		static const FGameplayTag Gaits[]
+		{
+			AlsGaitTags::Walking,
+			AlsGaitTags::Running,
+			AlsGaitTags::Sprinting
+		};
+
+		static_assert(UE_ARRAY_COUNT(Gaits) == GaitsCount);
+
+		return Gaits;
 	}
 
-	if (Gait == AlsGaitTags::Running)
+	// Comparing a few tags is much cheaper than hashing them.
+
+	inline int32 GetRotationModeIndex(const FGameplayTag& RotationMode)
 	{
-		return RunSpeed;
+		return GetRotationModes().IndexOfByKey(RotationMode);
 	}
 
-	if (Gait == AlsGaitTags::Sprinting)
+	inline int32 GetStanceIndex(const FGameplayTag& Stance)
 	{
-		return SprintSpeed;
+		return GetStances().IndexOfByKey(Stance);
 	}
 
-	return 0.0f;
+	inline int32 GetGaitIndex(const FGameplayTag& Gait)
+	{
+		return GetGaits().IndexOfByKey(Gait);
+	}
+
+	inline FGameplayTag GetRotationModeByIndex(const int32 Index)
+	{
+		const auto RotationModes{GetRotationModes()};
+		return RotationModes.IsValidIndex(Index) ? RotationModes[Index] : FGameplayTag::EmptyTag;
+	}
+
+	inline FGameplayTag GetStanceByIndex(const int32 Index)
+	{
+		const auto Stances{GetStances()};
+		return Stances.IsValidIndex(Index) ? Stances[Index] : FGameplayTag::EmptyTag;
+	}
+
+	inline FGameplayTag GetGaitByIndex(const int32 Index)
+	{
+		const auto Gaits{GetGaits()};
+		return Gaits.IsValidIndex(Index) ? Gaits[Index] : FGameplayTag::EmptyTag;
+	}
+}
+
+inline const FAlsMovementBakedGaitCurves* UAlsMovementSettings::FindBakedGaitCurves(const int32 TableIndex) const
+{
+	if (TableIndex < 0 || TableIndex >= AlsMovementSettingsIndices::RotationModesCount * AlsMovementSettingsIndices::StancesCount)
+	{
+		return nullptr;
+	}
+
+	if (GaitSettingsTable.IsEmpty())
+	{
+		BuildGaitSettingsTable();
+	}
+
+	return BakedGaitCurves[TableIndex].GetPtrOrNull();
+}
+
+inline float FAlsMovementGaitSettings::GetSpeedByGait(const FGameplayTag& Gait) const
+{
+	return GetSpeedByGaitIndex(AlsMovementSettingsIndices::GetGaitIndex(Gait));
+}
+
+inline float FAlsMovementGaitSettings::GetSpeedByGaitIndex(const int32 GaitIndex) const
+{
+	switch (GaitIndex)
+	{
+		case 0:
+			return WalkSpeed;
+
+		case 1:
+			return RunSpeed;
+
+		case 2:
+			return SprintSpeed;
+
+		default:
+			return 0.0f;
+	}
 }
@@ -24,6 +24,47 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	uint8 bLimitInitialRagdollSpeed : 1 {true};
 
+	// The controlling side sends the ragdoll target location no more often than this interval.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float TargetLocationSendInterval{0.05f};
+
+	// The ragdoll target location will not be sent until the ragdoll moves further than this distance from the last sent location.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float TargetLocationSendDistanceThreshold{2.0f};
+
+	// Speed of interpolation towards the received ragdoll target location on the non-controlling
+	// sides, which hides the reduced send rate. If zero, then interpolation will be disabled.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float TargetLocationInterpolationSpeed{15.0f};
+
+	// If checked, most of the per-frame ragdolling work (ground traces, pull force,
+	// motors update, etc.) will be suspended while the ragdoll is at rest.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bSuspendWhileAtRest : 1 {false};
+
+	// The ragdoll is considered at rest when all of its bodies are asleep or when its pelvis speed stays below this value for
+	// a while. Only the pelvis speed is checked, so limbs that keep moving while the pelvis is still may stop being driven.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bSuspendWhileAtRest", ForceUnits = "cm/s"))
+	float RestSpeedThreshold{5.0f};
+
+	// How long the ragdoll's speed should stay below the rest speed threshold for the ragdoll to be considered at rest.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bSuspendWhileAtRest", ForceUnits = "s"))
+	float RestTimeThreshold{0.5f};
+
+	// How often the ragdoll motors are updated when the character is at the reduced LOD level. If zero, then they will be updated every frame.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float ReducedLodMotorsUpdateInterval{0.1f};
+
+	// How often the ragdoll motors are updated when the character is at the minimal LOD level. If zero, then they will be updated every frame.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float MinimalLodMotorsUpdateInterval{0.25f};
+
+	// Ragdoll motors will not be updated until their stiffness changes by more than this value.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float MotorsStiffnessTolerance{250.0f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UAnimMontage> GetUpFrontMontage;
 
@@ -4,6 +4,42 @@
 
 class UAnimMontage;
 
+// Sent when rolling starts. Play rate is quantized to 0.01 steps and yaw angles to 16 bits.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsRollingParameters
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 655.35))
+	float PlayRate{1.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float InitialYawAngle{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float TargetYawAngle{0.0f};
+
+public:
+	static uint16 QuantizePlayRate(float PlayRate);
+
+	static float DequantizePlayRate(uint16 QuantizedPlayRate);
+
+	static uint16 QuantizeYawAngle(float YawAngle);
+
+	static float DequantizeYawAngle(uint16 QuantizedYawAngle);
+
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsRollingParameters> : public TStructOpsTypeTraitsBase2<FAlsRollingParameters>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsRollingSettings
 {
@@ -32,3 +68,23 @@ struct ALS_API FAlsRollingSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	uint8 bInterruptRollingWhenInAir : 1 {true};
 };
+
+inline uint16 FAlsRollingParameters::QuantizePlayRate(const float PlayRate)
+{
+	return static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(PlayRate * 100.0f), 0, MAX_uint16));
+}
+
+inline float FAlsRollingParameters::DequantizePlayRate(const uint16 QuantizedPlayRate)
+{
+	return QuantizedPlayRate * 0.01f;
+}
+
+inline uint16 FAlsRollingParameters::QuantizeYawAngle(const float YawAngle)
+{
+	return FRotator3f::CompressAxisToShort(YawAngle);
+}
+
+inline float FAlsRollingParameters::DequantizeYawAngle(const uint16 QuantizedYawAngle)
+{
+	return FRotator3f::NormalizeAxis(FRotator3f::DecompressAxisFromShort(QuantizedYawAngle));
+}
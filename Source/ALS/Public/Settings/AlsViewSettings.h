@@ -2,6 +2,42 @@
 
 #include "AlsViewSettings.generated.h"
 
+// Replicated view rotation. If the axis bits count is zero, the rotation is sent as a regular rotator with 16 bits
+// per axis. Otherwise, only the pitch and yaw are sent, each quantized to the axis bits count, and the roll is dropped.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsReplicatedViewRotation
+{
+	GENERATED_BODY()
+
+	static constexpr auto MaxAxisBitsCount{16};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator Rotation{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 16))
+	uint8 AxisBitsCount{0};
+
+public:
+	static uint32 QuantizeAxis(FRotator::FReal Angle, int32 AxisBitsCount);
+
+	static FRotator::FReal DequantizeAxis(uint32 QuantizedAngle, int32 AxisBitsCount);
+
+	// Returns the rotation exactly as it is received on remote sides, which allows
+	// the sending side to use the same value as the receiving sides.
+	static FRotator Quantize(const FRotator& Rotation, int32 AxisBitsCount);
+
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsReplicatedViewRotation> : public TStructOpsTypeTraitsBase2<FAlsReplicatedViewRotation>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsViewSettings
 {
@@ -12,4 +48,39 @@ struct ALS_API FAlsViewSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS")
 	uint8 bEnableListenServerNetworkSmoothing : 1 {true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (InlineEditConditionToggle))
+	uint8 bQuantizeReplicatedViewRotation : 1 {false};
+
+	// If enabled, only the pitch and yaw of the replicated view rotation are sent, each quantized to this number of bits,
+	// and the roll is dropped. Otherwise, the view rotation is sent as a regular rotator with 16 bits per axis.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS",
+		Meta = (ClampMin = 8, ClampMax = 16, EditCondition = "bQuantizeReplicatedViewRotation"))
+	int32 ReplicatedViewRotationAxisBitsCount{12};
+
+	// The replicated view rotation is only updated when any of its axes changes by more than this
+	// angle. This reduces the send rate at the cost of an error of up to this angle on remote sides.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 5, ForceUnits = "deg"))
+	float ReplicatedViewRotationSendThreshold{0.0f};
 };
+
+inline uint32 FAlsReplicatedViewRotation::QuantizeAxis(const FRotator::FReal Angle, const int32 AxisBitsCount)
+{
+	const auto StepsCount{1u << AxisBitsCount};
+
+	return static_cast<uint32>(FMath::RoundToInt64(FRotator::ClampAxis(Angle) * StepsCount / 360.0)) & (StepsCount - 1);
+}
+
+inline FRotator::FReal FAlsReplicatedViewRotation::DequantizeAxis(const uint32 QuantizedAngle, const int32 AxisBitsCount)
+{
+	return FRotator::NormalizeAxis(QuantizedAngle * 360.0 / (1u << AxisBitsCount));
+}
+
+inline FRotator FAlsReplicatedViewRotation::Quantize(const FRotator& Rotation, const int32 AxisBitsCount)
+{
+	return {
+		DequantizeAxis(QuantizeAxis(Rotation.Pitch, AxisBitsCount), AxisBitsCount),
+		DequantizeAxis(QuantizeAxis(Rotation.Yaw, AxisBitsCount), AxisBitsCount),
+		0.0f
+	};
+}
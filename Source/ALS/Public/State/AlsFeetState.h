@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+#include "WorldCollision.h"
+#include "Engine/HitResult.h"
 #include "Utility/AlsMath.h"
 #include "AlsFeetState.generated.h"
 
@@ -60,6 +62,37 @@ struct ALS_API FAlsFootState
 	FQuat IkRotation{ForceInit};
 };
 
+// Foot offset trace data used only when async IK traces are enabled in the feet settings. It's stored
+// separately from the foot states, so they don't carry a hit result when async traces are disabled.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsFootOffsetTraceState
+{
+	GENERATED_BODY()
+
+	FTraceHandle Handle;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bRequested : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bHitValid : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector Start{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector End{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	double RequestTime{0.0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	double HitTime{0.0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FHitResult Hit;
+};
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsFeetState
 {
@@ -88,4 +121,12 @@ struct ALS_API FAlsFeetState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FVector2f MinMaxPelvisOffsetZ{ForceInit};
+
+	// Async offset traces
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsFootOffsetTraceState LeftOffsetTrace;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsFootOffsetTraceState RightOffsetTrace;
 };
@@ -0,0 +1,16 @@
+﻿#pragma once
+
+#include "AlsLodLevel.generated.h"
+
+// Each level disables everything disabled by the previous levels. When used as a network LOD
+// level, the reduced level lowers the network update frequency and priority, and the minimal
+// level additionally stops the replication of the view rotation to simulated proxies.
+UENUM(BlueprintType)
+enum class EAlsLodLevel : uint8
+{
+	Full,
+	// Dynamic transitions are disabled, view network smoothing is refreshed at half rate and ragdoll motors are updated less often.
+	Reduced,
+	// Foot IK traces and ground prediction are disabled.
+	Minimal
+};
@@ -2,6 +2,21 @@
 
 #include "AlsMantlingState.generated.h"
 
+USTRUCT(BlueprintType)
+struct ALS_API FAlsRejectedMantlingTrace
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FIntVector LocationCell{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	int32 DirectionSector{0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "s"))
+	double Time{0.0f};
+};
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsMantlingState
 {
@@ -9,4 +24,10 @@ struct ALS_API FAlsMantlingState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	int32 RootMotionSourceId = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "s"))
+	double NextInAirTraceTime{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<FAlsRejectedMantlingTrace> RejectedInAirTraces;
 };
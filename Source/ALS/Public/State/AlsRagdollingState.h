@@ -10,12 +10,33 @@ struct ALS_API FAlsRagdollingState
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FVector Velocity{ForceInit};
 
+	// Locally used ragdoll target location. On the controlling side, it matches the pelvis location, on
+	// other sides, it is interpolated towards the replicated target location. Zero means it is not yet known.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector TargetLocation{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float TargetLocationSendTimeRemaining{0.0f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "N"))
 	float PullForce{0.0f};
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
 	int32 SpeedLimitFrameTimeRemaining{0};
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float RestTime{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bAtRest : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float MotorsUpdateTimeRemaining{0.0f};
+
+	// Stiffness last applied to the ragdoll motors. Negative value means that it hasn't been applied yet.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	float MotorsStiffness{-1.0f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm/s"))
 	float SpeedLimit{0.0f};
 };
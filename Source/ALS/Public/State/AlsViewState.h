@@ -30,6 +30,22 @@ struct ALS_API FAlsViewNetworkSmoothingState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FRotator CurrentRotation{ForceInit};
+
+	// Used to refresh network smoothing at a reduced rate on less significant characters.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bSkippedPreviousFrame : 1 {false};
+
+	// Time accumulated while network smoothing was skipped.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float SkippedTime{0.0f};
+
+	// Used while the view rotation is not replicated because of the network LOD level. In this
+	// case, the view rotation keeps the same yaw offset relative to the character's rotation.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bExtrapolating : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float ExtrapolationYawOffset{0.0f};
 };
 
 USTRUCT(BlueprintType)
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Containers/ArrayView.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class USkinnedAsset;
+class USkinnedMeshComponent;
+
+// Fetches world space transforms of several bones or sockets at once. Bone indices and socket local transforms are
+// resolved only when the skinned asset or the requested names change, so names are not looked up every frame.
+class ALS_API FAlsBoneTransformsCache
+{
+private:
+	TArray<FName, TInlineAllocator<4>> Names;
+
+	TArray<int32, TInlineAllocator<4>> BoneIndices;
+
+	// Socket transforms relative to their bones. Identity for bones.
+	TArray<FTransform, TInlineAllocator<4>> LocalTransforms;
+
+	TWeakObjectPtr<const USkinnedAsset> SkinnedAsset;
+
+public:
+	// Same as calling USkinnedMeshComponent::GetSocketTransform() for each name. Unresolved names return the component transform.
+	void GetTransforms(const USkinnedMeshComponent& Mesh, TConstArrayView<FName> NewNames, TArrayView<FTransform> Transforms);
+
+private:
+	bool IsResolvedFor(const USkinnedMeshComponent& Mesh, TConstArrayView<FName> NewNames) const;
+
+	void Resolve(const USkinnedMeshComponent& Mesh, TConstArrayView<FName> NewNames);
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Containers/Map.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class USkeleton;
+
+// Remembers the locations of animation curves in the animation curves map, which allows reading curve values without
+// hashing curve names every frame. The curves map is usually rebuilt in the same order every frame, so the cached
+// locations stay valid. Each location is verified before use and is resolved again with a regular lookup when needed.
+class ALS_API FAlsCurvesCache
+{
+private:
+	TArray<FName> CurveNames;
+
+	TArray<FSetElementId> CurveIds;
+
+	TWeakObjectPtr<const USkeleton> Skeleton;
+
+public:
+	void Initialize(TConstArrayView<FName> NewCurveNames, const USkeleton* NewSkeleton);
+
+	bool IsInitializedFor(const USkeleton* NewSkeleton) const;
+
+	// Returns 0 if the curve is missing, which matches the behavior of a regular lookup.
+	float GetCurveValue(const TMap<FName, float>& Curves, int32 CurveIndex);
+};
+
+inline void FAlsCurvesCache::Initialize(const TConstArrayView<FName> NewCurveNames, const USkeleton* NewSkeleton)
+{
+	CurveNames = NewCurveNames;
+
+	CurveIds.Reset(CurveNames.Num());
+	CurveIds.AddDefaulted(CurveNames.Num());
+
+	Skeleton = NewSkeleton;
+}
+
+inline bool FAlsCurvesCache::IsInitializedFor(const USkeleton* NewSkeleton) const
+{
+	return !CurveNames.IsEmpty() && Skeleton == NewSkeleton;
+}
+
+inline float FAlsCurvesCache::GetCurveValue(const TMap<FName, float>& Curves, const int32 CurveIndex)
+{
+	const auto& CurveName{CurveNames[CurveIndex]};
+	auto& CurveId{CurveIds[CurveIndex]};
+
+	if (Curves.IsValidId(CurveId))
+	{
+		// Comparing names is much cheaper than hashing them.
+
+		const auto& Curve{Curves.Get(CurveId)};
+		if (Curve.Key == CurveName)
+		{
+			return Curve.Value;
+		}
+	}
+
+	CurveId = Curves.FindId(CurveName);
+
+	return CurveId.IsValidId() ? Curves.Get(CurveId).Value : 0.0f;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Math/Color.h"
+
+struct FHitResult;
+
+enum class EAlsDebugTraceType : uint8
+{
+	LineTraceSingle,
+	SweepSphere,
+	SweepSingleSphere,
+	SweepSingleCapsule,
+	SweepSingleCapsuleAlternative
+};
+
+struct ALS_API FAlsDebugTrace
+{
+	EAlsDebugTraceType Type{EAlsDebugTraceType::LineTraceSingle};
+
+	// Whether there is a blocking hit to draw.
+	bool bHit{false};
+
+	FVector Start{ForceInit};
+
+	FVector End{ForceInit};
+
+	FRotator Rotation{ForceInit};
+
+	float Radius{0.0f};
+
+	float HalfHeight{0.0f};
+
+	FVector HitLocation{ForceInit};
+
+	FVector HitImpactPoint{ForceInit};
+
+	FLinearColor TraceColor{ForceInit};
+
+	FLinearColor HitColor{ForceInit};
+
+	float Duration{0.0f};
+};
+
+// Ring buffer of debug traces that are recorded, possibly on a worker thread, and then drawn together on the game
+// thread. The storage is allocated only once, on the first use, so recording traces doesn't allocate any memory.
+// When the buffer is full, the oldest traces are overwritten. The buffer itself is not thread safe.
+class ALS_API FAlsDebugTracesBuffer
+{
+public:
+	static constexpr auto Capacity{64};
+
+private:
+	TArray<FAlsDebugTrace> Traces;
+
+	int32 FirstIndex{0};
+
+	int32 Count{0};
+
+public:
+	void AddLineTraceSingle(const FVector& Start, const FVector& End, bool bHit, const FHitResult& Hit,
+	                        const FLinearColor& TraceColor, const FLinearColor& HitColor, float Duration = 0.0f);
+
+	void AddSweepSphere(const FVector& Start, const FVector& End, float Radius, const FLinearColor& Color, float Duration = 0.0f);
+
+	void AddSweepSingleSphere(const FVector& Start, const FVector& End, float Radius, bool bHit, const FHitResult& Hit,
+	                          const FLinearColor& SweepColor, const FLinearColor& HitColor, float Duration = 0.0f);
+
+	void AddSweepSingleCapsule(const FVector& Start, const FVector& End, const FRotator& Rotation, float Radius, float HalfHeight,
+	                           bool bHit, const FHitResult& Hit, const FLinearColor& SweepColor, const FLinearColor& HitColor,
+	                           float Duration = 0.0f);
+
+	void AddSweepSingleCapsuleAlternative(const FVector& Start, const FVector& End, float Radius, float HalfHeight,
+	                                      bool bHit, const FHitResult& Hit, const FLinearColor& SweepColor,
+	                                      const FLinearColor& HitColor, float Duration = 0.0f);
+
+	// Draws all recorded traces and clears the buffer. Must be called on the game thread.
+	void Flush(const UObject* WorldContext);
+
+	void Reset();
+
+	bool IsEmpty() const;
+
+private:
+	FAlsDebugTrace& Add(EAlsDebugTraceType Type, const FVector& Start, const FVector& End, bool bHit, const FHitResult* Hit,
+	                    const FLinearColor& TraceColor, const FLinearColor& HitColor, float Duration);
+};
+
+inline void FAlsDebugTracesBuffer::Reset()
+{
+	FirstIndex = 0;
+	Count = 0;
+}
+
+inline bool FAlsDebugTracesBuffer::IsEmpty() const
+{
+	return Count <= 0;
+}
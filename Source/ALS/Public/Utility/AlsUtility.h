@@ -32,6 +32,10 @@ public:
 	static float GetFirstPlayerPingSeconds(const UObject* WorldContext);
 
 	static bool TryGetMovementBaseRotationSpeed(const FBasedMovementInfo& BasedMovement, FRotator& RotationSpeed);
+
+	// Returns the location as it is received on remote sides after being sent as FVector_NetQuantize,
+	// which allows the sending side to use exactly the same value as the receiving sides.
+	static FVector RoundTripNetQuantize(const FVector& Location);
 };
 
 constexpr FStringView UAlsUtility::BoolToString(const bool bValue)
@@ -1,8 +1,10 @@
 #include "AlsCameraComponent.h"
 
 #include "AlsCameraSettings.h"
+#include "AlsCharacter.h"
 #include "DrawDebugHelpers.h"
 #include "Animation/AnimInstance.h"
+#include "Animation/AnimSequenceBase.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/WorldSettings.h"
 #include "Utility/AlsCameraConstants.h"
@@ -13,6 +15,20 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCameraComponent)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Camera Trace Cache Hits"), STAT_AlsCameraTraceCacheHits, STATGROUP_Als)
+
+namespace AlsCameraTraceCache
+{
+	FIntVector QuantizeLocation(const FVector& Location, const float Step)
+	{
+		return {
+			FMath::RoundToInt32(Location.X / Step),
+			FMath::RoundToInt32(Location.Y / Step),
+			FMath::RoundToInt32(Location.Z / Step)
+		};
+	}
+}
+
 UAlsCameraComponent::UAlsCameraComponent()
 {
 	PrimaryComponentTick.bStartWithTickEnabled = false;
@@ -26,6 +42,14 @@ void UAlsCameraComponent::OnRegister()
 {
 	Character = Cast<ACharacter>(GetOwner());
 
+	if (bUseCurvesSources)
+	{
+		// The camera curves are sampled directly from the curves sources, so neither the animation instance nor the bone pose are needed.
+
+		AnimationMode = EAnimationMode::AnimationCustomMode;
+		bNoSkeletonUpdate = true;
+	}
+
 	Super::OnRegister();
 }
 
@@ -60,7 +84,7 @@ void UAlsCameraComponent::InitAnim(const bool bForceReinitialize)
 
 void UAlsCameraComponent::BeginPlay()
 {
-	ALS_ENSURE(IsValid(GetAnimInstance()));
+	ALS_ENSURE(bUseCurvesSources || IsValid(GetAnimInstance()));
 	ALS_ENSURE(IsValid(Settings));
 	ALS_ENSURE(IsValid(Character));
 
@@ -107,7 +131,12 @@ FVector UAlsCameraComponent::GetThirdPersonPivotLocation() const
 {
 	const auto* Mesh{Character->GetMesh()};
 
-	FVector FirstPivotLocation;
+	const FName PivotSocketNames[]{Settings->ThirdPerson.FirstPivotSocketName, Settings->ThirdPerson.SecondPivotSocketName};
+	FTransform PivotTransforms[UE_ARRAY_COUNT(PivotSocketNames)];
+
+	PivotTransformsCache.GetTransforms(*Mesh, PivotSocketNames, PivotTransforms);
+
+	auto FirstPivotLocation{PivotTransforms[0].GetLocation()};
 
 	if (!IsValid(Mesh->GetAttachParent()) && Settings->ThirdPerson.FirstPivotSocketName == UAlsConstants::RootBoneName())
 	{
@@ -116,19 +145,22 @@ FVector UAlsCameraComponent::GetThirdPersonPivotLocation() const
 		FirstPivotLocation = Character->GetRootComponent()->GetComponentLocation();
 		FirstPivotLocation.Z -= Character->GetRootComponent()->Bounds.BoxExtent.Z;
 	}
-	else
-	{
-		FirstPivotLocation = Mesh->GetSocketLocation(Settings->ThirdPerson.FirstPivotSocketName);
-	}
 
-	return (FirstPivotLocation + Mesh->GetSocketLocation(Settings->ThirdPerson.SecondPivotSocketName)) * 0.5f;
+	return (FirstPivotLocation + PivotTransforms[1].GetLocation()) * 0.5f;
 }
 
 FVector UAlsCameraComponent::GetThirdPersonTraceStartLocation() const
 {
-	return Character->GetMesh()->GetSocketLocation(bRightShoulder
-		                                               ? Settings->ThirdPerson.TraceShoulderRightSocketName
-		                                               : Settings->ThirdPerson.TraceShoulderLeftSocketName);
+	const FName TraceStartSocketName{
+		bRightShoulder ? Settings->ThirdPerson.TraceShoulderRightSocketName : Settings->ThirdPerson.TraceShoulderLeftSocketName
+	};
+
+	FTransform TraceStartTransform;
+
+	TraceStartTransformCache.GetTransforms(*Character->GetMesh(), MakeArrayView(&TraceStartSocketName, 1),
+	                                       MakeArrayView(&TraceStartTransform, 1));
+
+	return TraceStartTransform.GetLocation();
 }
 
 void UAlsCameraComponent::GetViewInfo(FMinimalViewInfo& ViewInfo) const
@@ -150,7 +182,7 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::TickCamera"), STAT_UAlsCameraComponent_TickCamera, STATGROUP_Als)
 	TRACE_CPUPROFILER_EVENT_SCOPE(UAlsCameraComponent::TickCamera);
 
-	if (!IsValid(GetAnimInstance()) || !IsValid(Settings) || !IsValid(Character))
+	if ((!bUseCurvesSources && !IsValid(GetAnimInstance())) || !IsValid(Settings) || !IsValid(Character))
 	{
 		return;
 	}
@@ -164,6 +196,11 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 	const auto bDisplayDebugCameraShapes{
 		UAlsDebugUtility::ShouldDisplayDebugForActor(GetOwner(), UAlsCameraConstants::CameraShapesDebugDisplayName())
 	};
+
+	ON_SCOPE_EXIT
+	{
+		DisplayDebugTracesBuffer.Flush(GetWorld());
+	};
 #else
 	const auto bDisplayDebugCameraShapes{false};
 #endif
@@ -201,6 +238,11 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 		}
 	}
 
+	if (bUseCurvesSources)
+	{
+		RefreshCurvesSource(DeltaTime, bAllowLag);
+	}
+
 	const auto CameraTargetRotation{Character->GetViewRotation()};
 
 	const auto PreviousPivotTargetLocation{PivotTargetLocation};
@@ -208,7 +250,7 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 	PivotTargetLocation = GetThirdPersonPivotLocation();
 
 	const auto FirstPersonOverride{
-		UAlsMath::Clamp01(GetAnimInstance()->GetCurveValue(UAlsCameraConstants::FirstPersonOverrideCurveName()))
+		UAlsMath::Clamp01(GetCameraCurveValue(UAlsCameraConstants::FirstPersonOverrideCurveName()))
 	};
 
 	if (FAnimWeight::IsFullWeight(FirstPersonOverride))
@@ -324,6 +366,109 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 	CameraFieldOfView = FMath::Clamp(CameraFieldOfView + CalculateFovOffset(), 5.0f, 175.0f);
 }
 
+void UAlsCameraComponent::RefreshCurvesSource(const float DeltaTime, const bool bAllowBlending)
+{
+	FGameplayTagContainer CharacterTags;
+
+	const auto* AlsCharacter{Cast<AAlsCharacter>(Character)};
+	if (IsValid(AlsCharacter))
+	{
+		CharacterTags.AddTag(AlsCharacter->GetViewMode());
+		CharacterTags.AddTag(AlsCharacter->GetLocomotionMode());
+		CharacterTags.AddTag(AlsCharacter->GetRotationMode());
+		CharacterTags.AddTag(AlsCharacter->GetStance());
+		CharacterTags.AddTag(AlsCharacter->GetGait());
+		CharacterTags.AddTag(AlsCharacter->GetOverlayMode());
+		CharacterTags.AddTag(AlsCharacter->GetLocomotionAction());
+	}
+
+	auto NewCurvesSourceIndex{INDEX_NONE};
+
+	for (auto i{0}; i < Settings->CurvesSources.Num(); i++)
+	{
+		const auto& CurvesSource{Settings->CurvesSources[i]};
+
+		if ((CurvesSource.Shoulder == EAlsCameraShoulderRequirement::Any ||
+		     (CurvesSource.Shoulder == EAlsCameraShoulderRequirement::Right) == bRightShoulder) &&
+		    CharacterTags.HasAll(CurvesSource.RequiredTags))
+		{
+			NewCurvesSourceIndex = i;
+			break;
+		}
+	}
+
+	if (NewCurvesSourceIndex != CurvesSourceIndex)
+	{
+		CurvesSourceIndex = NewCurvesSourceIndex;
+
+		// Curves sources don't depend on time, so their curves only need to be sampled once when the source changes.
+
+		CurvesSourceTargetValues.Reset();
+		CurvesSourceBlendDuration = 0.0f;
+
+		if (CurvesSourceIndex >= 0)
+		{
+			const auto& CurvesSource{Settings->CurvesSources[CurvesSourceIndex]};
+
+			if (IsValid(CurvesSource.Sequence))
+			{
+				FBlendedCurve SequenceCurves;
+
+				CurvesSource.Sequence->EvaluateCurveData(SequenceCurves, FAnimExtractContext{static_cast<double>(CurvesSource.SequenceTime)});
+
+				SequenceCurves.ForEachElement([this](const UE::Anim::FCurveElement& Curve)
+				{
+					CurvesSourceTargetValues.Add(Curve.Name, Curve.Value);
+				});
+			}
+
+			CurvesSourceTargetValues.Append(CurvesSource.Curves);
+			CurvesSourceBlendDuration = CurvesSource.BlendDuration;
+		}
+
+		if (CurvesSourceBlendDuration <= 0.0f)
+		{
+			CurvesSourceValues = CurvesSourceTargetValues;
+			CurvesSourceBlendTime = 0.0f;
+			return;
+		}
+
+		CurvesSourceInitialValues = CurvesSourceValues;
+		CurvesSourceBlendTime = 0.0f;
+	}
+
+	if (CurvesSourceBlendTime >= CurvesSourceBlendDuration)
+	{
+		return;
+	}
+
+	CurvesSourceBlendTime = bAllowBlending
+		                        ? FMath::Min(CurvesSourceBlendTime + DeltaTime, CurvesSourceBlendDuration)
+		                        : CurvesSourceBlendDuration;
+
+	const auto BlendAmount{CurvesSourceBlendTime / CurvesSourceBlendDuration};
+
+	CurvesSourceValues.Reset();
+
+	for (const auto& [CurveName, CurveValue] : CurvesSourceTargetValues)
+	{
+		CurvesSourceValues.Add(CurveName, FMath::Lerp(CurvesSourceInitialValues.FindRef(CurveName), CurveValue, BlendAmount));
+	}
+
+	for (const auto& [CurveName, CurveValue] : CurvesSourceInitialValues)
+	{
+		if (!CurvesSourceTargetValues.Contains(CurveName))
+		{
+			CurvesSourceValues.Add(CurveName, FMath::Lerp(CurveValue, 0.0f, BlendAmount));
+		}
+	}
+}
+
+float UAlsCameraComponent::GetCameraCurveValue(const FName& CurveName) const
+{
+	return bUseCurvesSources ? CurvesSourceValues.FindRef(CurveName) : GetAnimInstance()->GetCurveValue(CurveName);
+}
+
 FRotator UAlsCameraComponent::CalculateCameraRotation(const FRotator& CameraTargetRotation,
                                                       const float DeltaTime, const bool bAllowLag) const
 {
@@ -332,7 +477,7 @@ FRotator UAlsCameraComponent::CalculateCameraRotation(const FRotator& CameraTarg
 		return CameraTargetRotation;
 	}
 
-	const auto RotationLag{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::RotationLagCurveName())};
+	const auto RotationLag{GetCameraCurveValue(UAlsCameraConstants::RotationLagCurveName())};
 
 	if (!Settings->bEnableCameraLagSubstepping ||
 	    DeltaTime <= Settings->CameraLagSubstepping.LagSubstepDeltaTime ||
@@ -374,9 +519,9 @@ FVector UAlsCameraComponent::CalculatePivotLagLocation(const FQuat& CameraYawRot
 	const auto RelativePivotInitialLagLocation{CameraYawRotation.UnrotateVector(PivotLagLocation)};
 	const auto RelativePivotTargetLocation{CameraYawRotation.UnrotateVector(PivotTargetLocation)};
 
-	const auto LocationLagX{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagXCurveName())};
-	const auto LocationLagY{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagYCurveName())};
-	const auto LocationLagZ{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagZCurveName())};
+	const auto LocationLagX{GetCameraCurveValue(UAlsCameraConstants::LocationLagXCurveName())};
+	const auto LocationLagY{GetCameraCurveValue(UAlsCameraConstants::LocationLagYCurveName())};
+	const auto LocationLagZ{GetCameraCurveValue(UAlsCameraConstants::LocationLagZCurveName())};
 
 	if (!Settings->bEnableCameraLagSubstepping ||
 	    DeltaTime <= Settings->CameraLagSubstepping.LagSubstepDeltaTime ||
@@ -431,9 +576,9 @@ FVector UAlsCameraComponent::CalculatePivotOffset() const
 {
 	return Character->GetMesh()->GetComponentQuat().RotateVector(
 		FVector{
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetXCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetYCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetZCurveName())
+			GetCameraCurveValue(UAlsCameraConstants::PivotOffsetXCurveName()),
+			GetCameraCurveValue(UAlsCameraConstants::PivotOffsetYCurveName()),
+			GetCameraCurveValue(UAlsCameraConstants::PivotOffsetZCurveName())
 		} * Character->GetMesh()->GetComponentScale().Z);
 }
 
@@ -441,19 +586,19 @@ FVector UAlsCameraComponent::CalculateCameraOffset() const
 {
 	return CameraRotation.RotateVector(
 		FVector{
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetXCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetYCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetZCurveName())
+			GetCameraCurveValue(UAlsCameraConstants::CameraOffsetXCurveName()),
+			GetCameraCurveValue(UAlsCameraConstants::CameraOffsetYCurveName()),
+			GetCameraCurveValue(UAlsCameraConstants::CameraOffsetZCurveName())
 		} * Character->GetMesh()->GetComponentScale().Z);
 }
 
 float UAlsCameraComponent::CalculateFovOffset() const
 {
-	return GetAnimInstance()->GetCurveValue(UAlsCameraConstants::FovOffsetCurveName());
+	return GetCameraCurveValue(UAlsCameraConstants::FovOffsetCurveName());
 }
 
 FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLocation, const FVector& PivotOffset,
-                                                  const float DeltaTime, const bool bAllowLag, float& NewTraceDistanceRatio) const
+                                                  const float DeltaTime, const bool bAllowLag, float& NewTraceDistanceRatio)
 {
 #if ENABLE_DRAW_DEBUG
 	const auto bDisplayDebugCameraTraces{
@@ -471,40 +616,123 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 		FMath::Lerp(
 			GetThirdPersonTraceStartLocation(),
 			PivotTargetLocation + PivotOffset + FVector{Settings->ThirdPerson.TraceOverrideOffset},
-			UAlsMath::Clamp01(GetAnimInstance()->GetCurveValue(UAlsCameraConstants::TraceOverrideCurveName())))
+			UAlsMath::Clamp01(GetCameraCurveValue(UAlsCameraConstants::TraceOverrideCurveName())))
 	};
 
 	const auto TraceEnd{CameraTargetLocation};
 	const auto CollisionShape{FCollisionShape::MakeSphere(Settings->ThirdPerson.TraceRadius * MeshScale)};
 
 	auto TraceResult{TraceEnd};
+	auto bBlockingHit{false};
+
+	ReceiveAsyncTrace();
+
+	// Reuse the previous trace result if the trace has barely moved since then, which is a very common case for idle or aiming players.
 
-	FHitResult Hit;
-	if (GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
-	                                     CollisionShape, {MainTraceTag, false, GetOwner()}))
+	const auto TraceCacheStep{FMath::Max(Settings->ThirdPerson.TraceCacheQuantizationStep, UE_KINDA_SMALL_NUMBER)};
+
+	const auto NewTraceCacheStartKey{AlsCameraTraceCache::QuantizeLocation(TraceStart, TraceCacheStep)};
+	const auto NewTraceCacheEndKey{AlsCameraTraceCache::QuantizeLocation(TraceEnd, TraceCacheStep)};
+	const auto NewTraceCacheRadiusKey{FMath::RoundToInt32(CollisionShape.GetSphereRadius() / TraceCacheStep)};
+
+	const auto bTraceCacheHit{
+		Settings->ThirdPerson.bEnableTraceCache && bAllowLag && bTraceCacheValid &&
+		NewTraceCacheStartKey == TraceCacheStartKey && NewTraceCacheEndKey == TraceCacheEndKey &&
+		NewTraceCacheRadiusKey == TraceCacheRadiusKey &&
+		GetWorld()->GetRealTimeSeconds() - TraceCacheTime <= Settings->ThirdPerson.TraceCacheMaxAge
+	};
+
+	if (bTraceCacheHit)
+	{
+		INC_DWORD_STAT(STAT_AlsCameraTraceCacheHits);
+
+		TraceStart += TraceCacheStartAdjustment;
+		TraceResult = TraceStart + (TraceEnd - TraceStart) * TraceCacheHitTime;
+		bBlockingHit = bTraceCacheBlockingHit;
+	}
+	else
 	{
-		if (!Hit.bStartPenetrating)
+		const auto InitialTraceStart{TraceStart};
+
+		FHitResult Hit;
+		if (TryGetAsyncTraceHit(TraceStart, TraceEnd, bAllowLag, Hit))
 		{
-			TraceResult = Hit.Location;
+			if (Hit.IsValidBlockingHit())
+			{
+				// Project the hit onto the current trace, since it has moved slightly since the request.
+
+				TraceResult = TraceStart + (TraceEnd - TraceStart) * Hit.Time;
+			}
 		}
-		else if (TryAdjustLocationBlockedByGeometry(TraceStart, bDisplayDebugCameraTraces))
+		else if (GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
+		                                          CollisionShape, {MainTraceTag, false, GetOwner()}))
 		{
-			static const FName AdjustedTraceTag{FString::Printf(TEXT("%hs (Adjusted Trace)"), __FUNCTION__)};
-
-			GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
-			                                 CollisionShape, {AdjustedTraceTag, false, GetOwner()});
-			if (Hit.IsValidBlockingHit())
+			if (!Hit.bStartPenetrating)
 			{
 				TraceResult = Hit.Location;
 			}
+			else if (TryAdjustLocationBlockedByGeometry(TraceStart, bDisplayDebugCameraTraces))
+			{
+				static const FName AdjustedTraceTag{FString::Printf(TEXT("%hs (Adjusted Trace)"), __FUNCTION__)};
+
+				GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
+				                                 CollisionShape, {AdjustedTraceTag, false, GetOwner()});
+				if (Hit.IsValidBlockingHit())
+				{
+					TraceResult = Hit.Location;
+				}
+			}
+		}
+
+		bBlockingHit = Hit.IsValidBlockingHit();
+
+		if (Settings->ThirdPerson.bUseAsyncTrace)
+		{
+			// The result of this sweep will be received on the next frame.
+
+			static const FName AsyncTraceTag{FString::Printf(TEXT("%hs (Async Trace)"), __FUNCTION__)};
+
+			AsyncTraceHandle = GetWorld()->AsyncSweepByChannel(EAsyncTraceType::Single, TraceStart, TraceEnd, FQuat::Identity,
+			                                                   Settings->ThirdPerson.TraceChannel, CollisionShape,
+			                                                   {AsyncTraceTag, false, GetOwner()});
+
+			// Real time is used because the camera can ignore time dilation.
+
+			AsyncTraceRequestTime = GetWorld()->GetRealTimeSeconds();
+		}
+
+		bTraceCacheValid = Settings->ThirdPerson.bEnableTraceCache;
+
+		if (bTraceCacheValid)
+		{
+			const auto TraceVector{TraceEnd - TraceStart};
+			const auto TraceLengthSquared{TraceVector.SizeSquared()};
+
+			TraceCacheStartKey = NewTraceCacheStartKey;
+			TraceCacheEndKey = NewTraceCacheEndKey;
+			TraceCacheRadiusKey = NewTraceCacheRadiusKey;
+			TraceCacheTime = GetWorld()->GetRealTimeSeconds();
+
+			TraceCacheStartAdjustment = TraceStart - InitialTraceStart;
+			TraceCacheHitTime = TraceLengthSquared > UE_SMALL_NUMBER
+				                    ? UAlsMath::Clamp01(UE_REAL_TO_FLOAT(((TraceResult - TraceStart) | TraceVector) / TraceLengthSquared))
+				                    : 1.0f;
+			bTraceCacheBlockingHit = bBlockingHit;
 		}
 	}
 
+	if (Settings->ThirdPerson.bEnableTraceCache)
+	{
+		static constexpr auto HitRateSmoothingFactor{0.05f};
+
+		TraceCacheHitRate = FMath::Lerp(TraceCacheHitRate, bTraceCacheHit ? 1.0f : 0.0f, HitRateSmoothingFactor);
+	}
+
 #if ENABLE_DRAW_DEBUG
 	if (bDisplayDebugCameraTraces)
 	{
-		UAlsDebugUtility::DrawSweepSphere(GetWorld(), TraceStart, TraceResult, CollisionShape.GetCapsuleRadius(),
-		                                  Hit.IsValidBlockingHit() ? FLinearColor::Red : FLinearColor::Green);
+		DisplayDebugTracesBuffer.AddSweepSphere(TraceStart, TraceResult, CollisionShape.GetSphereRadius(),
+		                                        bBlockingHit ? FLinearColor::Red : FLinearColor::Green);
 	}
 #endif
 
@@ -535,6 +763,52 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 	return TraceStart + TraceVector * TraceDistanceRatio;
 }
 
+void UAlsCameraComponent::ReceiveAsyncTrace()
+{
+	if (!AsyncTraceHandle.IsValid())
+	{
+		return;
+	}
+
+	FTraceDatum TraceDatum;
+	if (GetWorld()->QueryTraceData(AsyncTraceHandle, TraceDatum))
+	{
+		bAsyncTraceHitValid = true;
+		AsyncTraceHit = TraceDatum.OutHits.Num() > 0 ? TraceDatum.OutHits[0] : FHitResult{TraceDatum.Start, TraceDatum.End};
+		AsyncTraceHitTime = AsyncTraceRequestTime;
+	}
+	else
+	{
+		bAsyncTraceHitValid = false;
+	}
+
+	AsyncTraceHandle = {};
+}
+
+bool UAlsCameraComponent::TryGetAsyncTraceHit(const FVector& TraceStart, const FVector& TraceEnd,
+                                              const bool bAllowLag, FHitResult& Hit) const
+{
+	// Use a synchronous sweep if the async sweep result is too old or if the trace has moved too far since the request.
+	// Penetrating hits also require a synchronous sweep, since the trace start location must be adjusted in this case.
+
+	if (!Settings->ThirdPerson.bUseAsyncTrace || !bAsyncTraceHitValid || !bAllowLag || AsyncTraceHit.bStartPenetrating ||
+	    GetWorld()->GetRealTimeSeconds() - AsyncTraceHitTime > Settings->ThirdPerson.AsyncTraceMaxAge)
+	{
+		return false;
+	}
+
+	const auto MaxDistanceSquared{FMath::Square(Settings->ThirdPerson.AsyncTraceMaxDistance)};
+
+	if (FVector::DistSquared(AsyncTraceHit.TraceStart, TraceStart) > MaxDistanceSquared ||
+	    FVector::DistSquared(AsyncTraceHit.TraceEnd, TraceEnd) > MaxDistanceSquared)
+	{
+		return false;
+	}
+
+	Hit = AsyncTraceHit;
+	return true;
+}
+
 bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location, const bool bDisplayDebugCameraTraces) const
 {
 	// Based on ComponentEncroachesBlockingGeometry_WithAdjustment().
@@ -1,5 +1,6 @@
 #include "AlsCameraComponent.h"
 
+#include "AlsCameraSettings.h"
 #include "DisplayDebugHelpers.h"
 #include "Animation/AnimInstance.h"
 #include "Engine/Canvas.h"
@@ -119,7 +120,15 @@ void UAlsCameraComponent::DisplayDebugCurves(const UCanvas* Canvas, const float
 	const auto ColumnOffset{145.0f * Scale};
 
 	TArray<FName> CurveNames;
-	GetAnimInstance()->GetAllCurveNames(CurveNames);
+
+	if (bUseCurvesSources)
+	{
+		CurvesSourceValues.GenerateKeyArray(CurveNames);
+	}
+	else
+	{
+		GetAnimInstance()->GetAllCurveNames(CurveNames);
+	}
 
 	CurveNames.Sort([](const FName& A, const FName& B)
 	{
@@ -130,7 +139,7 @@ void UAlsCameraComponent::DisplayDebugCurves(const UCanvas* Canvas, const float
 
 	for (const auto& CurveName : CurveNames)
 	{
-		const auto CurveValue{GetAnimInstance()->GetCurveValue(CurveName)};
+		const auto CurveValue{GetCameraCurveValue(CurveName)};
 
 		Text.SetColor(FMath::Lerp(FLinearColor::Gray, FLinearColor::White, UAlsMath::Clamp01(FMath::Abs(CurveValue))));
 
@@ -315,6 +324,21 @@ void UAlsCameraComponent::DisplayDebugTraces(const UCanvas* Canvas, const float
 	Text.Draw(Canvas->Canvas, {HorizontalLocation, VerticalLocation});
 
 	VerticalLocation += RowOffset;
+
+	if (!IsValid(Settings) || !Settings->ThirdPerson.bEnableTraceCache)
+	{
+		return;
+	}
+
+	TStringBuilder<64> TraceCacheHitRateBuilder;
+	TraceCacheHitRateBuilder.Appendf(TEXT("Trace Cache Hit Rate: %.0f%%"), TraceCacheHitRate * 100.0f);
+
+	Text.SetColor(FLinearColor::White);
+
+	Text.Text = FText::AsCultureInvariant(FString{TraceCacheHitRateBuilder});
+	Text.Draw(Canvas->Canvas, {HorizontalLocation, VerticalLocation});
+
+	VerticalLocation += RowOffset;
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,139 @@
+#include "AlsCameraComponent.h"
+#include "AlsCameraSettings.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/AnimData/IAnimationDataController.h"
+#include "Engine/Engine.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "Misc/AutomationTest.h"
+#include "Utility/AlsCameraConstants.h"
+#include "Utility/AlsGameplayTags.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+namespace AlsCameraComponentTests
+{
+	UAlsCameraComponent* CreateCamera(ACharacter& Character, USkeletalMesh* Mesh,
+	                                  UAlsCameraSettings* Settings, const bool bUseCurvesSources)
+	{
+		auto* Camera{NewObject<UAlsCameraComponent>(&Character)};
+
+		// These properties are only meant to be edited in the details panel, so set them the same way it does.
+
+		CastFieldChecked<FObjectProperty>(UAlsCameraComponent::StaticClass()->FindPropertyByName(TEXT("Settings")))
+			->SetObjectPropertyValue_InContainer(Camera, Settings);
+
+		CastFieldChecked<FBoolProperty>(UAlsCameraComponent::StaticClass()->FindPropertyByName(TEXT("bUseCurvesSources")))
+			->SetPropertyValue_InContainer(Camera, bUseCurvesSources);
+
+		Camera->SetSkeletalMeshAsset(Mesh);
+		Camera->SetupAttachment(Character.GetRootComponent());
+		Camera->RegisterComponent();
+
+		return Camera;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsCameraComponentCurvesSourcesTest, "Als.CameraComponent.CurvesSources",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsCameraComponentCurvesSourcesTest::RunTest(const FString& Parameters)
+{
+	// Drives one camera by the camera animation instance and another by the curves sources using the same curves,
+	// and compares the resulting camera transforms. The animation instance plays a single sequence here instead of
+	// the camera animation blueprint, so that both cameras receive exactly the same curve values.
+
+	auto* Mesh{LoadObject<USkeletalMesh>(nullptr, TEXT("/ALS/ALSCamera/SKM_Als_Camera.SKM_Als_Camera"))};
+	if (!TestNotNull(TEXT("Camera mesh"), Mesh))
+	{
+		return false;
+	}
+
+	const TPair<FName, float> Curves[]{
+		{UAlsCameraConstants::PivotOffsetZCurveName(), 40.0f},
+		{UAlsCameraConstants::CameraOffsetXCurveName(), -250.0f},
+		{UAlsCameraConstants::CameraOffsetYCurveName(), 50.0f},
+		{UAlsCameraConstants::CameraOffsetZCurveName(), 15.0f},
+		{UAlsCameraConstants::FovOffsetCurveName(), 5.0f},
+		{UAlsCameraConstants::FirstPersonOverrideCurveName(), 0.25f}
+	};
+
+	auto* Sequence{NewObject<UAnimSequence>(GetTransientPackage())};
+	Sequence->SetSkeleton(Mesh->GetSkeleton());
+
+	auto& Controller{Sequence->GetController()};
+	Controller.InitializeModel();
+	Controller.SetFrameRate(FFrameRate{30, 1}, false);
+	Controller.SetNumberOfFrames(FFrameNumber{1}, false);
+
+	for (const auto& [CurveName, CurveValue] : Curves)
+	{
+		const FAnimationCurveIdentifier CurveIdentifier{CurveName, ERawCurveTrackTypes::RCT_Float};
+
+		Controller.AddCurve(CurveIdentifier, AACF_DefaultCurve, false);
+		Controller.SetCurveKeys(CurveIdentifier, {FRichCurveKey{0.0f, CurveValue}}, false);
+	}
+
+	Controller.NotifyPopulated();
+
+	auto* Settings{NewObject<UAlsCameraSettings>()};
+
+	// Not used, because the character doesn't have the required tag.
+
+	auto& FirstPersonCurvesSource{Settings->CurvesSources.AddDefaulted_GetRef()};
+	FirstPersonCurvesSource.RequiredTags.AddTag(AlsViewModeTags::FirstPerson);
+	FirstPersonCurvesSource.Curves.Add(UAlsCameraConstants::FirstPersonOverrideCurveName(), 1.0f);
+
+	Settings->CurvesSources.AddDefaulted_GetRef().Sequence = Sequence;
+
+	auto* World{UWorld::CreateWorld(EWorldType::Game, false)};
+
+	auto& WorldContext{GEngine->CreateNewWorldContext(EWorldType::Game)};
+	WorldContext.SetCurrentWorld(World);
+
+	ON_SCOPE_EXIT
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	};
+
+	World->InitializeActorsForPlay(FURL{});
+
+	auto* Character{World->SpawnActor<ACharacter>(FVector{100.0f, 200.0f, 300.0f}, FRotator{0.0f, 30.0f, 0.0f})};
+	if (!TestNotNull(TEXT("Character"), Character))
+	{
+		return false;
+	}
+
+	auto* AnimationCamera{AlsCameraComponentTests::CreateCamera(*Character, Mesh, Settings, false)};
+
+	AnimationCamera->PlayAnimation(Sequence, false);
+	AnimationCamera->TickAnimation(0.0f, false);
+	AnimationCamera->RefreshBoneTransforms();
+
+	auto* CurvesSourcesCamera{AlsCameraComponentTests::CreateCamera(*Character, Mesh, Settings, true)};
+
+	TestNull(TEXT("Curves sources camera animation instance"), CurvesSourcesCamera->GetAnimInstance());
+
+	AnimationCamera->Activate(true);
+	CurvesSourcesCamera->Activate(true);
+
+	FMinimalViewInfo AnimationViewInfo;
+	AnimationCamera->GetViewInfo(AnimationViewInfo);
+
+	FMinimalViewInfo CurvesSourcesViewInfo;
+	CurvesSourcesCamera->GetViewInfo(CurvesSourcesViewInfo);
+
+	TestTrue(TEXT("Camera location"), AnimationViewInfo.Location.Equals(CurvesSourcesViewInfo.Location, 0.01f));
+	TestTrue(TEXT("Camera rotation"), AnimationViewInfo.Rotation.Equals(CurvesSourcesViewInfo.Rotation, 0.01f));
+	TestEqual(TEXT("Camera field of view"), AnimationViewInfo.FOV, CurvesSourcesViewInfo.FOV, 0.01f);
+
+	// Make sure the comparison is not trivially satisfied by both cameras ignoring the curves.
+
+	TestFalse(TEXT("Camera offset applied"), CurvesSourcesViewInfo.Location.Equals(Character->GetActorLocation(), 1.0f));
+
+	return true;
+}
+
+#endif
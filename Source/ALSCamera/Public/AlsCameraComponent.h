@@ -1,6 +1,9 @@
 #pragma once
 
+#include "WorldCollision.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Utility/AlsBoneTransformsCache.h"
+#include "Utility/AlsDebugTracesBuffer.h"
 #include "Utility/AlsMath.h"
 #include "AlsCameraComponent.generated.h"
 
@@ -29,6 +32,11 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ClampMax = 1))
 	float PostProcessWeight{0.0f};
 
+	// If checked, the camera curves are taken from the curves sources of the camera settings instead of the camera
+	// animation blueprint. No animation instance is created and no bone pose is evaluated in this mode.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", AdvancedDisplay)
+	uint8 bUseCurvesSources : 1 {false};
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	TObjectPtr<ACharacter> Character;
 
@@ -74,6 +82,73 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bRightShoulder : 1 {true};
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	int32 CurvesSourceIndex{INDEX_NONE};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ClampMin = 0, ForceUnits = "s"))
+	float CurvesSourceBlendDuration{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ClampMin = 0, ForceUnits = "s"))
+	float CurvesSourceBlendTime{0.0f};
+
+	// Curve values at the moment the curves source was changed.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TMap<FName, float> CurvesSourceInitialValues;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TMap<FName, float> CurvesSourceTargetValues;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TMap<FName, float> CurvesSourceValues;
+
+	mutable FAlsBoneTransformsCache PivotTransformsCache;
+
+	mutable FAlsBoneTransformsCache TraceStartTransformCache;
+
+#if ENABLE_DRAW_DEBUG
+	FAlsDebugTracesBuffer DisplayDebugTracesBuffer;
+#endif
+
+	FTraceHandle AsyncTraceHandle;
+
+	double AsyncTraceRequestTime{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	uint8 bAsyncTraceHitValid : 1 {false};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FHitResult AsyncTraceHit;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ForceUnits = "s"))
+	double AsyncTraceHitTime{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	uint8 bTraceCacheValid : 1 {false};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FIntVector TraceCacheStartKey{ForceInit};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FIntVector TraceCacheEndKey{ForceInit};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	int32 TraceCacheRadiusKey{0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ForceUnits = "s"))
+	double TraceCacheTime{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FVector TraceCacheStartAdjustment{ForceInit};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ClampMin = 0, ClampMax = 1))
+	float TraceCacheHitTime{1.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	uint8 bTraceCacheBlockingHit : 1 {false};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ClampMin = 0, ClampMax = 1, ForceUnits = "%"))
+	float TraceCacheHitRate{0.0f};
+
 public:
 	UAlsCameraComponent();
 
@@ -127,6 +202,10 @@ public:
 private:
 	void TickCamera(float DeltaTime, bool bAllowLag = true);
 
+	void RefreshCurvesSource(float DeltaTime, bool bAllowBlending);
+
+	float GetCameraCurveValue(const FName& CurveName) const;
+
 	FRotator CalculateCameraRotation(const FRotator& CameraTargetRotation, float DeltaTime, bool bAllowLag) const;
 
 	FVector CalculatePivotLagLocation(const FQuat& CameraYawRotation, float DeltaTime, bool bAllowLag) const;
@@ -138,7 +217,11 @@ private:
 	float CalculateFovOffset() const;
 
 	FVector CalculateCameraTrace(const FVector& CameraTargetLocation, const FVector& PivotOffset,
-	                             float DeltaTime, bool bAllowLag, float& NewTraceDistanceRatio) const;
+	                             float DeltaTime, bool bAllowLag, float& NewTraceDistanceRatio);
+
+	void ReceiveAsyncTrace();
+
+	bool TryGetAsyncTraceHit(const FVector& TraceStart, const FVector& TraceEnd, bool bAllowLag, FHitResult& Hit) const;
 
 	bool TryAdjustLocationBlockedByGeometry(FVector& Location, bool bDisplayDebugCameraTraces) const;
 
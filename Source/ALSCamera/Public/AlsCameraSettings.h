@@ -1,10 +1,13 @@
 ﻿#pragma once
 
+#include "GameplayTagContainer.h"
 #include "Engine/DataAsset.h"
 #include "Engine/Scene.h"
 #include "Utility/AlsConstants.h"
 #include "AlsCameraSettings.generated.h"
 
+class UAnimSequenceBase;
+
 USTRUCT(BlueprintType)
 struct ALSCAMERA_API FAlsFirstPersonCameraSettings
 {
@@ -55,6 +58,36 @@ struct ALSCAMERA_API FAlsThirdPersonCameraSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FVector3f TraceOverrideOffset{0.0f, 0.0f, 40.0f};
 
+	// If checked, the camera collision sweep is performed asynchronously and the result of the previous frame's
+	// sweep is used. This reduces the cost of the camera on the game thread at the cost of a one frame delay.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bUseAsyncTrace : 1 {false};
+
+	// Async sweep results older than this are discarded and a synchronous sweep is performed instead.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bUseAsyncTrace", ForceUnits = "s"))
+	float AsyncTraceMaxAge{0.1f};
+
+	// A synchronous sweep is performed instead of using the async sweep result if the
+	// trace start or end location has moved further than this distance since the request.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bUseAsyncTrace", ForceUnits = "cm"))
+	float AsyncTraceMaxDistance{10.0f};
+
+	// If checked, the previous camera trace result is reused while the quantized trace start,
+	// end, and radius stay the same, which avoids redundant sweeps when the camera barely moves.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bEnableTraceCache : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0.01, EditCondition = "bEnableTraceCache", ForceUnits = "cm"))
+	float TraceCacheQuantizationStep{1.0f};
+
+	// Cached trace results older than this are discarded so that moving geometry is eventually taken into account.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bEnableTraceCache", ForceUnits = "s"))
+	float TraceCacheMaxAge{0.1f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (InlineEditConditionToggle))
 	uint8 bEnableTraceDistanceSmoothing : 1 {true};
 
@@ -72,6 +105,43 @@ struct ALSCAMERA_API FAlsCameraLagSubsteppingSettings
 	float LagSubstepDeltaTime{1.0f / 60.0f};
 };
 
+UENUM(BlueprintType)
+enum class EAlsCameraShoulderRequirement : uint8
+{
+	Any,
+	Right,
+	Left
+};
+
+USTRUCT(BlueprintType)
+struct ALSCAMERA_API FAlsCameraCurvesSource
+{
+	GENERATED_BODY()
+
+	// The source is used only if the character has all of these tags. The character tags are its view mode,
+	// locomotion mode, rotation mode, stance, gait, overlay mode and locomotion action.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTagContainer RequiredTags;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	EAlsCameraShoulderRequirement Shoulder{EAlsCameraShoulderRequirement::Any};
+
+	// The curves are taken from a single frame of this animation, the bone pose is not evaluated.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TObjectPtr<UAnimSequenceBase> Sequence;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float SequenceTime{0.0f};
+
+	// Curve values applied on top of the sequence curves.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TMap<FName, float> Curves;
+
+	// How long it takes to blend from the curves of the previously used source.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float BlendDuration{0.0f};
+};
+
 UCLASS(Blueprintable, BlueprintType)
 class ALSCAMERA_API UAlsCameraSettings : public UDataAsset
 {
@@ -102,6 +172,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FPostProcessSettings PostProcess;
 
+	// Used by camera components with curves sources enabled instead of the camera animation blueprint. The first source
+	// whose requirements are met by the character provides the camera curves, any curve it does not provide is zero.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TArray<FAlsCameraCurvesSource> CurvesSources;
+
 public:
 #if WITH_EDITORONLY_DATA
 	virtual void Serialize(FArchive& Archive) override;
@@ -0,0 +1,401 @@
+﻿#include "Commandlets/AlsBenchmarkCommandlet.h"
+
+#include "AlsCharacter.h"
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Stats/StatsData.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Utility/AlsGameplayTags.h"
+#include "Utility/AlsLog.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsBenchmarkCommandlet)
+
+namespace AlsBenchmarkCommandlet
+{
+	static constexpr auto LaneWidth{400.0f};
+
+	// Each character repeats the same script with this period. The characters are offset from each
+	// other in time, so that at any given moment they are doing different things.
+	static constexpr auto ScriptFramesCount{360};
+
+#if STATS
+	class FStatsCollector
+	{
+	private:
+		struct FStatSamples
+		{
+			TArray<double> Values;
+
+			bool bDuration{false};
+		};
+
+		FCriticalSection SamplesLock;
+
+		TMap<FName, FStatSamples> Samples;
+
+		FDelegateHandle NewFrameDelegateHandle;
+
+	public:
+		void Start();
+
+		void Stop();
+
+		FString ToCsv();
+
+	private:
+		// Called on the stats thread.
+		void OnNewFrame(int64 Frame);
+	};
+
+	void FStatsCollector::Start()
+	{
+		StatsPrimaryEnableAdd();
+
+		NewFrameDelegateHandle = FStatsThreadState::GetLocalState().NewFrameDelegate.AddRaw(this, &FStatsCollector::OnNewFrame);
+	}
+
+	void FStatsCollector::Stop()
+	{
+		FStatsThreadState::GetLocalState().NewFrameDelegate.Remove(NewFrameDelegateHandle);
+
+		StatsPrimaryEnableSubtract();
+	}
+
+	void FStatsCollector::OnNewFrame(const int64 Frame)
+	{
+		class FGroupFilter : public IItemFilter
+		{
+		public:
+			virtual bool Keep(const FStatMessage& Item) override
+			{
+				static const FName GroupName{TEXTVIEW("STATGROUP_Als")};
+
+				return Item.NameAndInfo.GetGroupName() == GroupName;
+			}
+		};
+
+		const auto& StatsState{FStatsThreadState::GetLocalState()};
+		if (!StatsState.IsFrameValid(Frame))
+		{
+			return;
+		}
+
+		FGroupFilter GroupFilter;
+		TArray<FStatMessage> Messages;
+
+		StatsState.GetInclusiveAggregateStackStats(Frame, Messages, &GroupFilter);
+
+		FScopeLock Lock{&SamplesLock};
+
+		for (const auto& Message : Messages)
+		{
+			auto& StatSamples{Samples.FindOrAdd(Message.NameAndInfo.GetShortName())};
+
+			switch (Message.NameAndInfo.GetField<EStatDataType>())
+			{
+				case EStatDataType::ST_int64:
+					if (Message.NameAndInfo.GetFlag(EStatMetaFlags::IsPackedCCAndDuration))
+					{
+						StatSamples.Values.Add(FPlatformTime::ToMilliseconds64(FromPackedCallCountDuration_Duration(Message.GetValue_int64())));
+						StatSamples.bDuration = true;
+					}
+					else if (Message.NameAndInfo.GetFlag(EStatMetaFlags::IsCycle))
+					{
+						StatSamples.Values.Add(FPlatformTime::ToMilliseconds64(Message.GetValue_int64()));
+						StatSamples.bDuration = true;
+					}
+					else
+					{
+						StatSamples.Values.Add(Message.GetValue_int64());
+					}
+					break;
+
+				case EStatDataType::ST_double:
+					StatSamples.Values.Add(Message.GetValue_double());
+					break;
+
+				default:
+					break;
+			}
+		}
+	}
+
+	FString FStatsCollector::ToCsv()
+	{
+		FScopeLock Lock{&SamplesLock};
+
+		TStringBuilder<4096> CsvBuilder;
+		CsvBuilder << TEXTVIEW("Stat,Unit,Frames,Average,Median,P90,P99,Max\n");
+
+		Samples.KeySort(FNameLexicalLess{});
+
+		for (auto& [StatName, StatSamples] : Samples)
+		{
+			auto& Values{StatSamples.Values};
+			if (Values.IsEmpty())
+			{
+				continue;
+			}
+
+			Values.Sort();
+
+			double Sum{0.0};
+			for (const auto Value : Values)
+			{
+				Sum += Value;
+			}
+
+			const auto GetPercentile{
+				[&Values](const double Percentile)
+				{
+					return Values[FMath::Clamp(FMath::CeilToInt32(Percentile * Values.Num()) - 1, 0, Values.Num() - 1)];
+				}
+			};
+
+			CsvBuilder.Appendf(TEXT("%s,%s,%d,%f,%f,%f,%f,%f\n"), *StatName.ToString(),
+			                   StatSamples.bDuration ? TEXT("ms") : TEXT("count"), Values.Num(), Sum / Values.Num(),
+			                   GetPercentile(0.5), GetPercentile(0.9), GetPercentile(0.99), Values.Last());
+		}
+
+		return FString{CsvBuilder};
+	}
+#endif
+}
+
+UAlsBenchmarkCommandlet::UAlsBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = true;
+	IsEditor = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UAlsBenchmarkCommandlet::Main(const FString& Parameters)
+{
+#if !STATS
+	UE_LOG(LogAls, Error, TEXT("%hs: Stats are disabled in this build configuration."), __FUNCTION__);
+	return 1;
+#else
+	if (!FThreadStats::WillEverCollectData())
+	{
+		UE_LOG(LogAls, Error, TEXT("%hs: Stats are disabled, run the commandlet with -LoadTimeStatsForCommandlet."), __FUNCTION__);
+		return 1;
+	}
+
+	auto CharactersCount{16};
+	FParse::Value(*Parameters, TEXT("Characters="), CharactersCount);
+	CharactersCount = FMath::Max(1, CharactersCount);
+
+	auto FramesCount{1800};
+	FParse::Value(*Parameters, TEXT("Frames="), FramesCount);
+	FramesCount = FMath::Max(1, FramesCount);
+
+	auto DeltaTime{1.0f / 60.0f};
+	FParse::Value(*Parameters, TEXT("DeltaTime="), DeltaTime);
+	DeltaTime = FMath::Max(UE_KINDA_SMALL_NUMBER, DeltaTime);
+
+	FString CharacterClassPath{TEXTVIEW("/ALS/ALS/Character/B_Als_Character.B_Als_Character_C")};
+	FParse::Value(*Parameters, TEXT("CharacterClass="), CharacterClassPath);
+
+	auto OutputPath{FPaths::ProfilingDir() / TEXT("AlsBenchmark.csv")};
+	FParse::Value(*Parameters, TEXT("Output="), OutputPath);
+
+	auto* CharacterClass{LoadClass<AAlsCharacter>(nullptr, *CharacterClassPath)};
+	if (!IsValid(CharacterClass))
+	{
+		UE_LOG(LogAls, Error, TEXT("%hs: Failed to load character class %s."), __FUNCTION__, *CharacterClassPath);
+		return 1;
+	}
+
+	const TStrongObjectPtr<UStaticMesh> CubeMesh{LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"))};
+	if (!CubeMesh.IsValid())
+	{
+		UE_LOG(LogAls, Error, TEXT("%hs: Failed to load the obstacle mesh."), __FUNCTION__);
+		return 1;
+	}
+
+	auto* World{CreateBenchmarkWorld()};
+
+	// Each character gets its own lane with a floor and a low obstacle to mantle onto.
+
+	SpawnObstacle(World, CubeMesh.Get(), {2000.0f, CharactersCount * AlsBenchmarkCommandlet::LaneWidth * 0.5f, -50.0f},
+	              {60.0f, CharactersCount * AlsBenchmarkCommandlet::LaneWidth / 100.0f + 10.0f, 1.0f});
+
+	TArray<AAlsCharacter*> Characters;
+	TArray<FVector> StartLocations;
+
+	Characters.Reserve(CharactersCount);
+	StartLocations.Reserve(CharactersCount);
+
+	for (auto i{0}; i < CharactersCount; i++)
+	{
+		const FVector StartLocation{0.0f, (i + 0.5f) * AlsBenchmarkCommandlet::LaneWidth, 100.0f};
+
+		SpawnObstacle(World, CubeMesh.Get(), StartLocation + FVector{700.0f, 0.0f, -50.0f}, {2.0f, 2.0f, 1.0f});
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		auto* Character{World->SpawnActor<AAlsCharacter>(CharacterClass, StartLocation, FRotator::ZeroRotator, SpawnParameters)};
+		if (!IsValid(Character))
+		{
+			continue;
+		}
+
+		if (!IsValid(Character->GetController()))
+		{
+			Character->SpawnDefaultController();
+		}
+
+		Characters.Add(Character);
+		StartLocations.Add(StartLocation);
+	}
+
+	UE_LOG(LogAls, Display, TEXT("%hs: Running %d frames with %d characters."), __FUNCTION__, FramesCount, Characters.Num());
+
+	AlsBenchmarkCommandlet::FStatsCollector StatsCollector;
+	StatsCollector.Start();
+
+	for (auto Frame{0}; Frame < FramesCount; Frame++)
+	{
+		for (auto i{0}; i < Characters.Num(); i++)
+		{
+			auto* Character{Characters[i]};
+			if (!IsValid(Character))
+			{
+				continue;
+			}
+
+			// Offset the script for each character, and return the character to its lane when the script starts over.
+
+			const auto ScriptFrame{(Frame + i * 23) % AlsBenchmarkCommandlet::ScriptFramesCount};
+
+			if (ScriptFrame == 0 && Frame > 0)
+			{
+				Character->StopRagdolling();
+				Character->TeleportTo(StartLocations[i], FRotator::ZeroRotator);
+			}
+
+			DriveCharacter(Character, i, ScriptFrame);
+		}
+
+		GFrameCounter++;
+
+		World->Tick(LEVELTICK_All, DeltaTime);
+
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		FTSTicker::GetCoreTicker().Tick(DeltaTime);
+
+		FStats::AdvanceFrame(false);
+	}
+
+	// Give the stats thread a chance to process the last frames.
+
+	FStats::AdvanceFrame(false);
+	FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+	FPlatformProcess::Sleep(0.1f);
+
+	StatsCollector.Stop();
+
+	DestroyBenchmarkWorld(World);
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutputPath), true);
+
+	if (!FFileHelper::SaveStringToFile(StatsCollector.ToCsv(), *OutputPath))
+	{
+		UE_LOG(LogAls, Error, TEXT("%hs: Failed to write %s."), __FUNCTION__, *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogAls, Display, TEXT("%hs: Results written to %s."), __FUNCTION__, *OutputPath);
+	return 0;
+#endif
+}
+
+UWorld* UAlsBenchmarkCommandlet::CreateBenchmarkWorld()
+{
+	auto* World{UWorld::CreateWorld(EWorldType::Game, false, TEXT("AlsBenchmark"))};
+
+	auto& WorldContext{GEngine->CreateNewWorldContext(EWorldType::Game)};
+	WorldContext.SetCurrentWorld(World);
+
+	const FURL Url;
+
+	World->SetGameMode(Url);
+	World->InitializeActorsForPlay(Url);
+	World->BeginPlay();
+
+	return World;
+}
+
+void UAlsBenchmarkCommandlet::DestroyBenchmarkWorld(UWorld* World)
+{
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+}
+
+void UAlsBenchmarkCommandlet::SpawnObstacle(UWorld* World, UStaticMesh* Mesh, const FVector& Location, const FVector& Scale)
+{
+	auto* Obstacle{World->SpawnActor<AStaticMeshActor>(Location, FRotator::ZeroRotator)};
+	if (!IsValid(Obstacle))
+	{
+		return;
+	}
+
+	// The mesh of a static component can't be changed after registration in game worlds.
+
+	Obstacle->SetMobility(EComponentMobility::Movable);
+	Obstacle->GetStaticMeshComponent()->SetStaticMesh(Mesh);
+	Obstacle->SetActorScale3D(Scale);
+}
+
+void UAlsBenchmarkCommandlet::DriveCharacter(AAlsCharacter* Character, const int32 CharacterIndex, const int32 Frame)
+{
+	// Grounded movement at different gaits, a jump, mantling onto the obstacle, a roll, and ragdolling.
+
+	if (Frame < 250)
+	{
+		Character->AddMovementInput(FVector::ForwardVector);
+	}
+
+	if (Frame == 0)
+	{
+		Character->SetDesiredGait(CharacterIndex % 2 == 0 ? AlsGaitTags::Running : AlsGaitTags::Walking);
+	}
+	else if (Frame == 30)
+	{
+		Character->SetDesiredGait(AlsGaitTags::Sprinting);
+	}
+	else if (Frame == 50)
+	{
+		Character->Jump();
+	}
+	else if (Frame == 70)
+	{
+		Character->StopJumping();
+		Character->SetDesiredGait(AlsGaitTags::Running);
+	}
+	else if (Frame >= 90 && Frame < 180 && Character->GetLocomotionAction() != AlsLocomotionActionTags::Mantling)
+	{
+		Character->StartMantlingGrounded();
+	}
+	else if (Frame == 200)
+	{
+		Character->StartRolling();
+	}
+	else if (Frame == 270)
+	{
+		Character->StartRagdolling();
+	}
+	else if (Frame == 340)
+	{
+		Character->StopRagdolling();
+	}
+}
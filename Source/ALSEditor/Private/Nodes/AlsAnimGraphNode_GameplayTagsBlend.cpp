@@ -1,5 +1,6 @@
 #include "Nodes/AlsAnimGraphNode_GameplayTagsBlend.h"
 
+#include "Kismet2/CompilerResultsLog.h"
 #include "Utility/AlsUtility.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimGraphNode_GameplayTagsBlend)
@@ -76,6 +77,28 @@ void UAlsAnimGraphNode_GameplayTagsBlend::CustomizePinData(UEdGraphPin* Pin, con
 	}
 }
 
+void UAlsAnimGraphNode_GameplayTagsBlend::ValidateAnimNodeDuringCompilation(USkeleton* Skeleton, FCompilerResultsLog& MessageLog)
+{
+	Super::ValidateAnimNodeDuringCompilation(Skeleton, MessageLog);
+
+	TSet<FGameplayTag> UniqueTags;
+	UniqueTags.Reserve(Node.Tags.Num());
+
+	for (const auto& Tag : Node.Tags)
+	{
+		bool bAlreadyInSet;
+		UniqueTags.Add(Tag, &bAlreadyInSet);
+
+		if (bAlreadyInSet)
+		{
+			// Only the first pose of duplicate tags can ever become active.
+
+			MessageLog.Warning(*FText::Format(LOCTEXT("DuplicateTag", "@@ contains duplicate tag {0}, its pose will never be used."),
+			                                  FText::FromName(Tag.GetTagName())).ToString(), this);
+		}
+	}
+}
+
 void UAlsAnimGraphNode_GameplayTagsBlend::GetBlendPinProperties(const UEdGraphPin* Pin, bool& bBlendPosePin, bool& bBlendTimePin)
 {
 	const auto PinFullName{Pin->PinName.ToString()};
@@ -0,0 +1,34 @@
+﻿#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "AlsBenchmarkCommandlet.generated.h"
+
+class AAlsCharacter;
+class UStaticMesh;
+
+// Spawns a number of characters in an empty world, drives them through grounded movement, jumping, mantling,
+// rolling, and ragdolling, and writes per-frame statistics of every STATGROUP_Als stat to a CSV file.
+// Doesn't require a rendered game session and can be run on build machines with -nullrhi. Stats are disabled
+// in commandlets by default, so -LoadTimeStatsForCommandlet is required, otherwise the commandlet fails.
+//
+// Usage: UnrealEditor-Cmd <Project> -run=AlsBenchmark -nullrhi -LoadTimeStatsForCommandlet [-Characters=16] [-Frames=1800]
+//        [-DeltaTime=0.0166667] [-CharacterClass=/Path/To/Character.Character_C] [-Output=Path/To/Result.csv]
+UCLASS()
+class ALSEDITOR_API UAlsBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAlsBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Parameters) override;
+
+private:
+	static UWorld* CreateBenchmarkWorld();
+
+	static void DestroyBenchmarkWorld(UWorld* World);
+
+	static void SpawnObstacle(UWorld* World, UStaticMesh* Mesh, const FVector& Location, const FVector& Scale);
+
+	static void DriveCharacter(AAlsCharacter* Character, int32 CharacterIndex, int32 Frame);
+};